@@ -18,12 +18,139 @@
 
 export let propertyCache = {};
 
-export function invalidateCache(realmId) {
+// Collections with a live server-side notifier, per realm. Core pushes exact
+// {deletions, insertions, modifications} index deltas for these, so the
+// beforenotify invalidation leaves their cached entries in place and
+// applyCollectionDelta patches them instead of refetching the whole view.
+const watchedCollections = {};
+
+// Returns true the first time a collection is watched, so the caller knows to
+// register the server-side listener exactly once.
+export function watchCollection(realmId, id) {
+  let watched = watchedCollections[realmId] || (watchedCollections[realmId] = new Set());
+  if (watched.has(id)) {
+    return false;
+  }
+  watched.add(id);
+  return true;
+}
+
+export function unwatchCollection(realmId, id) {
+  let watched = watchedCollections[realmId];
+  if (watched) {
+    watched.delete(id);
+  }
+  let realmCache = propertyCache[realmId];
+  if (realmCache) {
+    delete realmCache[id];
+  }
+}
+
+export function invalidateCache(realmId, keepWatched = false) {
   if (realmId) {
-    propertyCache[realmId] = {};
+    let watched = watchedCollections[realmId];
+    if (keepWatched && watched && watched.size) {
+      let realmCache = propertyCache[realmId] || {};
+      let kept = {};
+      for (let id of watched) {
+        if (id in realmCache) {
+          kept[id] = realmCache[id];
+        }
+      }
+      propertyCache[realmId] = kept;
+    } else {
+      propertyCache[realmId] = {};
+    }
   } else {
     propertyCache = {};
+    for (let key in watchedCollections) {
+      delete watchedCollections[key];
+    }
+  }
+}
+
+// Changeset index arrays are Uint32Arrays on the server and arrive over the
+// wire as ArrayBuffers.
+function toIndexes(value) {
+  if (value == null) {
+    return [];
+  }
+  if (value instanceof ArrayBuffer) {
+    return Array.from(new Uint32Array(value));
+  }
+  return Array.from(value);
+}
+
+// `indexes` is sorted ascending; returns how many entries are smaller than
+// `index`, or -1 if `index` itself is present.
+function shiftFor(indexes, index) {
+  let count = 0;
+  for (let value of indexes) {
+    if (value < index) {
+      count++;
+    } else if (value === index) {
+      return -1;
+    } else {
+      break;
+    }
+  }
+  return count;
+}
+
+// Applies a collection changeset to the cached index entries: deleted rows are
+// dropped, surviving rows are shifted to their new indexes, and modified rows
+// are evicted so the next read refetches just those. Payload and work are
+// proportional to the change, not the collection size.
+export function applyCollectionDelta(realmId, id, changes) {
+  let realmCache = propertyCache[realmId];
+  let objCache = realmCache && realmCache[id];
+  if (!objCache) {
+    return;
+  }
+
+  // A deletions entry of null means the whole collection was invalidated.
+  if (Array.isArray(changes.deletions) && changes.deletions.length && changes.deletions[0] === null) {
+    delete realmCache[id];
+    return;
   }
+
+  let deletions = toIndexes(changes.deletions);
+  let insertions = toIndexes(changes.insertions);
+  let modifications = toIndexes(changes.newModifications || changes.modifications);
+
+  let moved = {};
+  for (let key of Object.keys(objCache)) {
+    if (!/^\d+$/.test(key)) {
+      if (key === "length" && (deletions.length || insertions.length)) {
+        delete objCache[key];
+      }
+      continue;
+    }
+
+    let index = Number(key);
+    let value = objCache[key];
+    delete objCache[key];
+
+    let deleted = shiftFor(deletions, index);
+    if (deleted < 0) {
+      continue;
+    }
+    let newIndex = index - deleted;
+    for (let insertion of insertions) {
+      if (insertion <= newIndex) {
+        newIndex++;
+      } else {
+        break;
+      }
+    }
+    moved[newIndex] = value;
+  }
+
+  for (let index of modifications) {
+    delete moved[index];
+  }
+
+  Object.assign(objCache, moved);
 }
 
 export function getRealmCache(realmId) {
@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// Minimal MessagePack codec for the debug-mode RPC wire format. It covers
+// exactly the JSON data model the RPC protocol uses (null, booleans, numbers,
+// strings, arrays and plain objects) - nothing else ever crosses the wire.
+
+const scratchBuffer = new ArrayBuffer(8);
+const scratchView = new DataView(scratchBuffer);
+const scratchBytes = new Uint8Array(scratchBuffer);
+
+function pushUtf8(string, bytes) {
+  for (let i = 0; i < string.length; i++) {
+    let code = string.codePointAt(i);
+    if (code > 0xffff) {
+      i++; // surrogate pair
+    }
+
+    if (code < 0x80) {
+      bytes.push(code);
+    } else if (code < 0x800) {
+      bytes.push(0xc0 | (code >> 6), 0x80 | (code & 0x3f));
+    } else if (code < 0x10000) {
+      bytes.push(0xe0 | (code >> 12), 0x80 | ((code >> 6) & 0x3f), 0x80 | (code & 0x3f));
+    } else {
+      bytes.push(0xf0 | (code >> 18), 0x80 | ((code >> 12) & 0x3f), 0x80 | ((code >> 6) & 0x3f), 0x80 | (code & 0x3f));
+    }
+  }
+}
+
+function pushLength(length, fixTag, tag16, tag32, bytes) {
+  if (length < 16) {
+    bytes.push(fixTag | length);
+  } else if (length < 0x10000) {
+    bytes.push(tag16, length >> 8, length & 0xff);
+  } else {
+    bytes.push(tag32, length >>> 24, (length >>> 16) & 0xff, (length >>> 8) & 0xff, length & 0xff);
+  }
+}
+
+function pushString(string, bytes) {
+  let utf8 = [];
+  pushUtf8(string, utf8);
+
+  let length = utf8.length;
+  if (length < 32) {
+    bytes.push(0xa0 | length);
+  } else if (length < 0x100) {
+    bytes.push(0xd9, length);
+  } else if (length < 0x10000) {
+    bytes.push(0xda, length >> 8, length & 0xff);
+  } else {
+    bytes.push(0xdb, length >>> 24, (length >>> 16) & 0xff, (length >>> 8) & 0xff, length & 0xff);
+  }
+
+  for (let i = 0; i < utf8.length; i++) {
+    bytes.push(utf8[i]);
+  }
+}
+
+function pushNumber(number, bytes) {
+  if (Number.isInteger(number) && number >= -0x80000000 && number <= 0xffffffff) {
+    if (number >= 0) {
+      if (number < 0x80) {
+        bytes.push(number);
+      } else if (number < 0x100) {
+        bytes.push(0xcc, number);
+      } else if (number < 0x10000) {
+        bytes.push(0xcd, number >> 8, number & 0xff);
+      } else {
+        bytes.push(0xce, number >>> 24, (number >>> 16) & 0xff, (number >>> 8) & 0xff, number & 0xff);
+      }
+    } else if (number >= -32) {
+      bytes.push(0x100 + number);
+    } else if (number >= -0x80) {
+      bytes.push(0xd0, number & 0xff);
+    } else if (number >= -0x8000) {
+      bytes.push(0xd1, (number >> 8) & 0xff, number & 0xff);
+    } else {
+      bytes.push(0xd2, (number >>> 24) & 0xff, (number >>> 16) & 0xff, (number >>> 8) & 0xff, number & 0xff);
+    }
+  } else {
+    scratchView.setFloat64(0, number);
+    bytes.push(0xcb);
+    for (let i = 0; i < 8; i++) {
+      bytes.push(scratchBytes[i]);
+    }
+  }
+}
+
+function pushValue(value, bytes) {
+  if (value === null || value === undefined) {
+    bytes.push(0xc0);
+    return;
+  }
+
+  switch (typeof value) {
+    case "boolean":
+      bytes.push(value ? 0xc3 : 0xc2);
+      return;
+    case "number":
+      pushNumber(value, bytes);
+      return;
+    case "string":
+      pushString(value, bytes);
+      return;
+  }
+
+  if (Array.isArray(value)) {
+    pushLength(value.length, 0x90, 0xdc, 0xdd, bytes);
+    for (let item of value) {
+      pushValue(item, bytes);
+    }
+    return;
+  }
+
+  let keys = Object.keys(value);
+  pushLength(keys.length, 0x80, 0xde, 0xdf, bytes);
+  for (let key of keys) {
+    pushString(key, bytes);
+    pushValue(value[key], bytes);
+  }
+}
+
+export function encode(value) {
+  let bytes = [];
+  pushValue(value, bytes);
+  return Uint8Array.from(bytes);
+}
+
+export function decode(buffer) {
+  let bytes = buffer instanceof Uint8Array ? buffer : new Uint8Array(buffer);
+  let view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+  let offset = 0;
+
+  function readString(length) {
+    let end = offset + length;
+    let string = "";
+    while (offset < end) {
+      let byte = bytes[offset++];
+      if (byte < 0x80) {
+        string += String.fromCharCode(byte);
+      } else if (byte < 0xe0) {
+        string += String.fromCharCode(((byte & 0x1f) << 6) | (bytes[offset++] & 0x3f));
+      } else if (byte < 0xf0) {
+        string += String.fromCharCode(((byte & 0x0f) << 12) | ((bytes[offset++] & 0x3f) << 6) | (bytes[offset++] & 0x3f));
+      } else {
+        string += String.fromCodePoint(
+          ((byte & 0x07) << 18) | ((bytes[offset++] & 0x3f) << 12) | ((bytes[offset++] & 0x3f) << 6) | (bytes[offset++] & 0x3f),
+        );
+      }
+    }
+    return string;
+  }
+
+  function readArray(length) {
+    let array = new Array(length);
+    for (let i = 0; i < length; i++) {
+      array[i] = readValue();
+    }
+    return array;
+  }
+
+  function readMap(length) {
+    let object = {};
+    for (let i = 0; i < length; i++) {
+      let key = readValue();
+      object[key] = readValue();
+    }
+    return object;
+  }
+
+  function readLength(size) {
+    let length = size == 1 ? bytes[offset] : size == 2 ? view.getUint16(offset) : view.getUint32(offset);
+    offset += size;
+    return length;
+  }
+
+  function readValue() {
+    let tag = bytes[offset++];
+    if (tag < 0x80) {
+      return tag; // positive fixint
+    }
+    if (tag >= 0xe0) {
+      return tag - 0x100; // negative fixint
+    }
+    if (tag < 0x90) {
+      return readMap(tag & 0x0f);
+    }
+    if (tag < 0xa0) {
+      return readArray(tag & 0x0f);
+    }
+    if (tag < 0xc0) {
+      return readString(tag & 0x1f);
+    }
+
+    switch (tag) {
+      case 0xc0:
+        return null;
+      case 0xc2:
+        return false;
+      case 0xc3:
+        return true;
+      case 0xca: {
+        let number = view.getFloat32(offset);
+        offset += 4;
+        return number;
+      }
+      case 0xcb: {
+        let number = view.getFloat64(offset);
+        offset += 8;
+        return number;
+      }
+      case 0xcc:
+        return readLength(1);
+      case 0xcd:
+        return readLength(2);
+      case 0xce:
+        return readLength(4);
+      case 0xcf: {
+        // 64-bit values lose precision beyond 2^53, same as JSON.parse
+        let number = view.getUint32(offset) * 0x100000000 + view.getUint32(offset + 4);
+        offset += 8;
+        return number;
+      }
+      case 0xd0: {
+        let number = view.getInt8(offset);
+        offset += 1;
+        return number;
+      }
+      case 0xd1: {
+        let number = view.getInt16(offset);
+        offset += 2;
+        return number;
+      }
+      case 0xd2: {
+        let number = view.getInt32(offset);
+        offset += 4;
+        return number;
+      }
+      case 0xd3: {
+        let number = view.getInt32(offset) * 0x100000000 + view.getUint32(offset + 4);
+        offset += 8;
+        return number;
+      }
+      case 0xd9:
+        return readString(readLength(1));
+      case 0xda:
+        return readString(readLength(2));
+      case 0xdb:
+        return readString(readLength(4));
+      case 0xdc:
+        return readArray(readLength(2));
+      case 0xdd:
+        return readArray(readLength(4));
+      case 0xde:
+        return readMap(readLength(2));
+      case 0xdf:
+        return readMap(readLength(4));
+      default:
+        throw new Error("Unsupported MessagePack tag: 0x" + tag.toString(16));
+    }
+  }
+
+  return readValue();
+}
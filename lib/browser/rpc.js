@@ -19,6 +19,7 @@
 import { EJSON, ObjectId, Decimal128 } from "bson";
 
 import * as base64 from "./base64";
+import * as msgpack from "./msgpack";
 import { keys, objectTypes } from "./constants";
 import { invalidateCache } from "./cache";
 
@@ -62,8 +63,11 @@ function beforeNotify(realm) {
   // property reads from the browser.
 
   // Clear the cache for this Realm, and reenable caching if it was disabled
-  // by a write transaction.
-  invalidateCache(realm[keys.realm]);
+  // by a write transaction. Watched collections are kept: core delivers exact
+  // index deltas for them on the same callback channel, and the server blocks
+  // in notify() until this poll completes, so their entries are patched by
+  // applyCollectionDelta rather than refetched wholesale.
+  invalidateCache(realm[keys.realm], true);
 }
 
 export function createSession(host, { versions, performFetch }) {
@@ -199,6 +203,19 @@ export function getProperty(realmId, id, name) {
   return deserialize(realmId, result);
 }
 
+export function readProperties(realmId, id, names) {
+  let result = sendRequest("read_properties", { realmId, id, names });
+  for (let key in result) {
+    result[key] = deserialize(realmId, result[key]);
+  }
+  return result;
+}
+
+export function readIndexes(realmId, id, start, count) {
+  let result = sendRequest("read_indexes", { realmId, id, start, count });
+  return result.map((value) => deserialize(realmId, value));
+}
+
 export function setProperty(realmId, id, name, value) {
   value = serialize(realmId, value);
   sendRequest("set_property", { realmId, id, name, value });
@@ -301,16 +318,23 @@ function makeRequest(url, data) {
   // The global __debug__ object is provided by Visual Studio Code.
   if (global.__debug__) {
     let request = global.__debug__.require("sync-request");
+    // This transport is backed by Node and carries binary bodies both ways,
+    // so it negotiates the compact MessagePack wire format with the server.
     let response = request("POST", url, {
-      body: JSON.stringify(data),
+      body: Buffer.from(msgpack.encode(data)),
       headers: {
-        "Content-Type": "text/plain;charset=UTF-8",
+        "Content-Type": "application/x-msgpack",
       },
     });
 
     statusCode = response.statusCode;
+    if (statusCode == 200) {
+      return msgpack.decode(response.body);
+    }
     responseText = response.body.toString("utf-8");
   } else {
+    // Synchronous XMLHttpRequest cannot change responseType, so the Chrome
+    // debugger transport has to stay on JSON text.
     let body = JSON.stringify(data);
     let request = new XMLHttpRequest();
 
@@ -36,6 +36,7 @@ createMethods(Session.prototype, objectTypes.SESSION, [
   "addConnectionNotification",
   "removeConnectionNotification",
   "isConnected",
+  "stats",
   "resume",
   "pause",
   "_waitForDownloadCompletion",
@@ -18,7 +18,7 @@
 
 import { keys } from "./constants";
 import * as rpc from "./rpc";
-import { invalidateCache, getRealmCache } from "./cache";
+import { invalidateCache, getRealmCache, watchCollection, unwatchCollection, applyCollectionDelta } from "./cache";
 
 export function createMethods(prototype, type, methodNames, mutating) {
   let props = {};
@@ -47,6 +47,11 @@ export function createMethod(type, name, mutating) {
     if (mutating) {
       invalidateCache(realmId);
     }
+    if (name === "removeListener" || name === "removeAllListeners") {
+      // Removing listeners may take the internal delta listener with it, so
+      // fall back to wholesale invalidation until the next read re-watches.
+      unwatchCollection(realmId, id);
+    }
     try {
       return rpc.callMethod(realmId, id, name, Array.from(arguments));
     } finally {
@@ -61,6 +66,15 @@ export function cacheObject(realmId, id, value) {
   getRealmCache(realmId)[id] = value;
 }
 
+// Number of indexed elements fetched per round trip when a collection read
+// misses the cache. Debug-mode list scrolling reads rows sequentially, so
+// paging ahead turns a round trip per row into one per page.
+const indexPageSize = 100;
+
+function isIndex(name) {
+  return typeof name === "number" || (typeof name === "string" && /^\d+$/.test(name));
+}
+
 export function getProperty(obj, name, cache = true) {
   let realmId = obj[keys.realm];
   let id = obj[keys.id];
@@ -70,6 +84,38 @@ export function getProperty(obj, name, cache = true) {
 
   let realmCache = getRealmCache(realmId);
   let objCache = realmCache[id];
+  if (isIndex(name)) {
+    if (!objCache) {
+      objCache = realmCache[id] = {};
+    }
+    if (watchCollection(realmId, id)) {
+      // First indexed read of this collection: register a server-side
+      // notifier so subsequent updates arrive as index deltas instead of
+      // invalidating the cached view wholesale.
+      try {
+        rpc.callMethod(realmId, id, "addListener", [(collection, changes) => applyCollectionDelta(realmId, id, changes)]);
+      } catch (e) {
+        // e.g. inside a write transaction, where listeners can't be added;
+        // a later read will retry.
+        unwatchCollection(realmId, id);
+      }
+    }
+    if (!(name in objCache)) {
+      let index = Number(name);
+      let start = index - (index % indexPageSize);
+      let values = rpc.readIndexes(realmId, id, start, indexPageSize);
+      for (let i = 0; i < values.length; i++) {
+        objCache[start + i] = values[i];
+      }
+      if (!(name in objCache)) {
+        // Out of range; remember that so repeated probes don't refetch the
+        // page. Mutations invalidate the whole cache anyway.
+        objCache[name] = undefined;
+      }
+    }
+    return objCache[name];
+  }
+
   if (!objCache) {
     objCache = realmCache[id] = rpc.getObject(realmId, id, name);
     return objCache[name];
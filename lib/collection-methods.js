@@ -35,6 +35,8 @@ Object.defineProperty(iteratorPrototype, Symbol.iterator, {
   "toLocaleString",
   "concat",
   "join",
+  // Results and List shadow "slice" with a native implementation on their own
+  // prototypes; this copy remains as the fallback for the other collections.
   "slice",
   "lastIndexOf",
   "every",
@@ -20,10 +20,8 @@ const dictionaryHandler = {
   get(target, key) {
     if (key === "toJSON") {
       return function () {
-        const keys = target._keys();
-        let obj = {};
-        keys.forEach((key) => (obj[key] = target.getter(key)));
-        return obj;
+        // getAll materializes all entries in a single native call.
+        return target.getAll();
       };
     }
 
@@ -51,7 +49,7 @@ const dictionaryHandler = {
 
   deleteProperty(target, key) {
     // this array must be kept in sync with methods implemented by js_dictonary.hpp
-    const methodNames = ["set", "remove", "addListener", "removeListener", "removeAllListeners"];
+    const methodNames = ["set", "putAll", "getAll", "remove", "addListener", "removeListener", "removeAllListeners"];
     if (!methodNames.includes(key)) {
       target.remove(key);
     }
@@ -71,6 +71,114 @@ module.exports = function (realmConstructor) {
     enumerable: false,
   });
 
+  Object.defineProperty(realmConstructor.Results.prototype, "filteredAsync", {
+    value: function (...args) {
+      return new Promise((resolve, reject) => {
+        this._filteredAsync(...args, (results, error) => {
+          if (error) {
+            reject(new Error(error.message));
+          } else {
+            resolve(results);
+          }
+        });
+      });
+    },
+
+    writable: true,
+    configurable: true,
+    enumerable: false,
+  });
+
+  Object.defineProperty(realmConstructor.Results.prototype, "sortedAsync", {
+    value: function (...args) {
+      return new Promise((resolve, reject) => {
+        this._sortedAsync(...args, (results, error) => {
+          if (error) {
+            reject(new Error(error.message));
+          } else {
+            resolve(results);
+          }
+        });
+      });
+    },
+
+    writable: true,
+    configurable: true,
+    enumerable: false,
+  });
+
+  Object.defineProperty(realmConstructor.prototype, "writeAsync", {
+    value: function (callback) {
+      return new Promise((resolve, reject) => {
+        this._writeAsync(callback, (result, error) => {
+          if (error) {
+            reject(new Error(error.message));
+          } else {
+            resolve(result);
+          }
+        });
+      });
+    },
+
+    writable: true,
+    configurable: true,
+    enumerable: false,
+  });
+
+  Object.defineProperty(realmConstructor.prototype, "deleteAllAsync", {
+    value: function () {
+      return new Promise((resolve, reject) => {
+        this._deleteAllAsync((error) => {
+          if (error) {
+            reject(new Error(error.message));
+          } else {
+            resolve();
+          }
+        });
+      });
+    },
+
+    writable: true,
+    configurable: true,
+    enumerable: false,
+  });
+
+  Object.defineProperty(realmConstructor.prototype, "compactAsync", {
+    value: function () {
+      return new Promise((resolve, reject) => {
+        this._compactAsync((compacted, error) => {
+          if (error) {
+            reject(new Error(error.message));
+          } else {
+            resolve(compacted);
+          }
+        });
+      });
+    },
+
+    writable: true,
+    configurable: true,
+    enumerable: false,
+  });
+
+  Object.defineProperty(realmConstructor.prototype, "writeCopyToAsync", {
+    value: function (path, encryptionKey) {
+      return new Promise((resolve, reject) => {
+        this._writeCopyToAsync(path, encryptionKey, (error) => {
+          if (error) {
+            reject(new Error(error.message));
+          } else {
+            resolve();
+          }
+        });
+      });
+    },
+
+    writable: true,
+    configurable: true,
+    enumerable: false,
+  });
+
   const getInternalCacheId = (realmObj) => {
     const { name, primaryKey } = realmObj.objectSchema();
     const id = primaryKey ? realmObj[primaryKey] : realmObj._objectId();
@@ -262,8 +370,66 @@ module.exports = function (realmConstructor) {
           }),
         );
 
+        // Downloaded changesets are integrated incrementally as they stream
+        // in, so when the caller names the object types its first screen
+        // needs, resolve as soon as those types are queryable in the local
+        // file instead of waiting for the whole bootstrap. The download keeps
+        // integrating in the background, and if the named types never receive
+        // objects the regular download-complete promise ends the race.
+        let stopQueryableCheck;
+        if (config.sync.resolveWhenQueryable !== undefined) {
+          const queryableTypes = config.sync.resolveWhenQueryable;
+          if (!Array.isArray(queryableTypes) || queryableTypes.some((name) => typeof name !== "string")) {
+            throw new Error("'resolveWhenQueryable' must be an array of object type names.");
+          }
+          openPromises.push(
+            new Promise((resolve) => {
+              let localRealm;
+              let settled = false;
+              // Called once the race settles: stop re-checking on progress
+              // notifications and, unless this promise won and handed its
+              // Realm to the caller, close the extra handle.
+              stopQueryableCheck = () => {
+                settled = true;
+                if (localRealm) {
+                  localRealm.close();
+                  localRealm = null;
+                }
+              };
+              const checkQueryable = () => {
+                if (settled) {
+                  return true;
+                }
+                try {
+                  if (!localRealm) {
+                    localRealm = new realmConstructor(config);
+                  }
+                  if (queryableTypes.every((name) => localRealm.objects(name).length > 0)) {
+                    const realm = localRealm;
+                    localRealm = null;
+                    settled = true;
+                    resolve(realm);
+                    return true;
+                  }
+                } catch (_) {
+                  // Tables not initialized yet; wait for more of the download.
+                }
+                return false;
+              };
+              if (!checkQueryable() && asyncOpenTask) {
+                asyncOpenTask.addDownloadNotification(() => {
+                  checkQueryable();
+                });
+              }
+            }),
+          );
+        }
+
         // Return wrapped promises, allowing the users to control them.
         let openPromise = Promise.race(openPromises);
+        if (stopQueryableCheck) {
+          openPromise.then(stopQueryableCheck, stopQueryableCheck);
+        }
         openPromise.cancel = () => {
           if (asyncOpenTask) {
             asyncOpenTask.cancel();
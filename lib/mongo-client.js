@@ -16,7 +16,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
-const { EJSON } = require("bson");
+const { EJSON, deserialize } = require("bson");
 const { DefaultNetworkTransport } = require("realm-network-transport");
 
 const { cleanArguments } = require("./utils");
@@ -196,11 +196,15 @@ class MongoDBCollection {
     }
 
     let watchStream = this.user._newWatchStream();
+    // SSE framing and EJSON parsing happen natively inside the watch stream;
+    // with the binary path enabled each change document comes back as a binary
+    // BSON buffer too, so the JS side never re-parses event text.
+    const binary = !!this.user.useBinaryFunctionCalls;
     for await (let chunk of reply.body) {
       watchStream.feedBuffer(chunk);
       while (watchStream.state == "HAVE_EVENT") {
-        let next = watchStream.nextEvent();
-        yield EJSON.parse(next);
+        let next = watchStream.nextEvent(binary);
+        yield binary ? deserialize(new Uint8Array(next)) : EJSON.parse(next);
       }
       if (watchStream.state == "HAVE_ERROR") throw watchStream.error;
     }
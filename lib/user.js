@@ -16,7 +16,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
-const { EJSON } = require("bson");
+const { EJSON, serialize, deserialize } = require("bson");
 
 const { MongoDBCollection } = require("./mongo-client");
 const { cleanArguments, promisify } = require("./utils");
@@ -32,6 +32,13 @@ const instanceMethods = {
 
   async callFunction(name, args = [], service = undefined) {
     const cleanedArgs = cleanArguments(args);
+    if (this.useBinaryFunctionCalls) {
+      // Opt-in binary path: arguments and results travel as binary BSON in
+      // buffers, skipping the EJSON stringify/re-parse on both sides.
+      const payload = serialize({ arguments: cleanedArgs });
+      const result = await promisify((cb) => this._callFunction(name, payload, service, cb));
+      return deserialize(new Uint8Array(result)).result;
+    }
     const stringifiedArgs = EJSON.stringify(cleanedArgs, { relaxed: false });
     const result = await promisify((cb) => this._callFunction(name, stringifiedArgs, service, cb));
     return EJSON.parse(result);
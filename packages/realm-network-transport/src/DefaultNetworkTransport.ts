@@ -24,6 +24,7 @@ import type {
   Fetch,
   AbortController,
   FetchResponse,
+  StreamReader,
 } from "./types";
 
 export class DefaultNetworkTransport implements NetworkTransport {
@@ -47,12 +48,34 @@ export class DefaultNetworkTransport implements NetworkTransport {
     // tslint:disable-next-line: no-console
     this.fetch(request)
       .then(async (response) => {
-        const decodedBody = await response.text();
         // Pull out the headers of the response
         const responseHeaders: Headers = {};
         response.headers.forEach((value, key) => {
           responseHeaders[key] = value;
         });
+
+        // Stream the body a chunk at a time when both sides support it,
+        // bounding peak memory instead of buffering the payload into one
+        // string. Chunks are raw UTF-8 bytes; the handler accumulates them.
+        const streamableBody = response.body as { getReader?: () => StreamReader } | null;
+        if (handler.onBodyChunk && streamableBody && typeof streamableBody.getReader === "function") {
+          const reader = streamableBody.getReader();
+          while (true) {
+            const { done, value } = await reader.read();
+            if (done) {
+              break;
+            }
+            if (value) {
+              handler.onBodyChunk(value);
+            }
+          }
+          return {
+            statusCode: response.status,
+            headers: responseHeaders,
+          };
+        }
+
+        const decodedBody = await response.text();
         return {
           statusCode: response.status,
           headers: responseHeaders,
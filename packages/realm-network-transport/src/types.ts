@@ -20,6 +20,11 @@ export type Method = "GET" | "POST" | "DELETE" | "PUT";
 
 export type Headers = { [name: string]: string };
 
+/** Minimal reader interface for streaming response bodies. */
+export type StreamReader = {
+  read: () => Promise<{ done: boolean; value?: Uint8Array }>;
+};
+
 export interface Request<RequestBody = unknown> extends FetchRequestInit<RequestBody> {
   method: Method;
   url: string;
@@ -29,7 +34,8 @@ export interface Request<RequestBody = unknown> extends FetchRequestInit<Request
 export interface CallbackResponse {
   statusCode: number;
   headers: Headers;
-  body: string;
+  /** Absent when the body was already delivered through `onBodyChunk`. */
+  body?: string;
 }
 
 export type SuccessCallback = (response: CallbackResponse) => void;
@@ -39,6 +45,12 @@ export type ErrorCallback = (err: Error) => void;
 export interface ResponseHandler {
   onSuccess: SuccessCallback;
   onError: ErrorCallback;
+  /**
+   * Optional streaming mode: when present, the transport may deliver the
+   * response body incrementally as raw UTF-8 chunks (before `onSuccess`)
+   * and omit `body` from the success callback.
+   */
+  onBodyChunk?: (chunk: Uint8Array) => void;
 }
 
 export interface NetworkTransport {
@@ -226,19 +226,26 @@ RCT_REMAP_METHOD(emit, emitEvent:(NSString *)eventName withObject:(id)object) {
 
         try {
             NSData *responseData;
+            NSString *contentType = @"application/json";
 
             if (rpcServer) {
-                std::string args = [[(GCDWebServerDataRequest *)request text] UTF8String];
+                // Pass the raw body through untouched; the RPC server negotiates
+                // between JSON text and MessagePack from the payload itself.
+                NSData *requestData = [(GCDWebServerDataRequest *)request data];
+                std::string args(static_cast<const char *>(requestData.bytes), requestData.length);
                 std::string responseText = rpcServer->perform_request(request.path.UTF8String, args);
 
                 responseData = [NSData dataWithBytes:responseText.c_str() length:responseText.length()];
+                if (responseText.length() && (static_cast<uint8_t>(responseText.front()) & 0x80)) {
+                    contentType = @"application/x-msgpack";
+                }
             }
             else {
                 // we have been deallocated
                 responseData = [NSData data];
             }
 
-            response = [[GCDWebServerDataResponse alloc] initWithData:responseData contentType:@"application/json"];
+            response = [[GCDWebServerDataResponse alloc] initWithData:responseData contentType:contentType];
         }
         catch(std::exception &ex) {
             NSLog(@"Invalid RPC request - %@", [(GCDWebServerDataRequest *)request text]);
@@ -119,82 +119,103 @@ Example for AARCH64:
 
 bool realmContextInjected;
 
-static void swap_function() __attribute__((constructor));
-
-static JSGlobalContextRef create_context(JSContextGroupRef group, JSClassRef global_class)
-{
-    static std::mutex s_mutex;
-    std::lock_guard<std::mutex> lock(s_mutex);
-
-    // Replace JSGlobalContextCreateInGroup with its original implementation and call it.
-    swap_function();
-    JSGlobalContextRef ctx = JSGlobalContextCreateInGroup(group, global_class);
-
-    // Reinstall the hook.
-    swap_function();
-
-    // Clear cache from previous instances.
-    RJSInvalidateCaches();
-
-    RJSInitializeInContext(ctx);
-    realmContextInjected = true;
-    return ctx;
-}
-
-static void swap_function()
+static void install_hook() __attribute__((constructor));
+static JSGlobalContextRef create_context(JSContextGroupRef group, JSClassRef global_class);
+
+// Everything the hook needs, resolved and assembled exactly once per process.
+// The target address comes straight from the dynamic linker (there is no
+// dlsym walk to repeat), so the per-swap work reduces to one memcpy of a
+// prepared byte block.
+struct HookState {
+    int8_t* orig_func;
+    uintptr_t page_start;
+    uintptr_t code_end;
+    int8_t orig_code[HOOK_SIZE];
+    int8_t hook_code[HOOK_SIZE];
+};
+
+static HookState& hook_state()
 {
-    // TODO: should we do a byte alignment for s_orig_code using alignas(16) or similar?
-    static int8_t s_orig_code[HOOK_SIZE];
-    static bool s_swapped = false;
+    static HookState state = [] {
+        HookState s{};
 
-    int8_t *orig_func = (int8_t*)&JSGlobalContextCreateInGroup;
-    int8_t *new_func = (int8_t*)&create_context;
+        int8_t *orig_func = (int8_t*)&JSGlobalContextCreateInGroup;
+        int8_t *new_func = (int8_t*)&create_context;
 
-    bool orig_thumb = false;
 #if __arm__ && !defined(__aarch64__)
-    orig_thumb = (uintptr_t)orig_func % 4 != 0;
-    if (orig_thumb) {
-        orig_func--;
-    }
+        bool orig_thumb = (uintptr_t)orig_func % 4 != 0;
+        if (orig_thumb) {
+            orig_func--;
+        }
 #endif
 
-    size_t page_size = sysconf(_SC_PAGESIZE);
-    uintptr_t page_start = (uintptr_t)orig_func & ~(page_size - 1);
-    uintptr_t code_end = (uintptr_t)orig_func + HOOK_SIZE;
-
-    // Make this memory region writable.
-    mprotect((void*)page_start, code_end - page_start, PROT_READ | PROT_WRITE | PROT_EXEC);
+        s.orig_func = orig_func;
+        size_t page_size = sysconf(_SC_PAGESIZE);
+        s.page_start = (uintptr_t)orig_func & ~(page_size - 1);
+        s.code_end = (uintptr_t)orig_func + HOOK_SIZE;
 
-    if (s_swapped) {
-        // Copy original code back into place.
-        memcpy(orig_func, s_orig_code, HOOK_SIZE);
-    } else {
-        // Store the original code before replacing it.
-        memcpy(s_orig_code, orig_func, HOOK_SIZE);
+        // The page is PROT_READ|PROT_EXEC at this point; reading is fine.
+        memcpy(s.orig_code, orig_func, HOOK_SIZE);
 
-#if __arm__ || __aarch64__
+#if __arm__ && !defined(__aarch64__)
         if (orig_thumb) {
             // LDR R3, [PC, #0]; BX R3;
-            memcpy(orig_func, "\x00\x4b\x18\x47", ARM_FUNCTION_HOOK_SIZE);
-            memcpy(orig_func + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
+            memcpy(s.hook_code, "\x00\x4b\x18\x47", ARM_FUNCTION_HOOK_SIZE);
+            memcpy(s.hook_code + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
         } else {
-            memcpy(orig_func, ARM_FUNCTION_HOOK, ARM_FUNCTION_HOOK_SIZE);
-            memcpy(orig_func + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
+            memcpy(s.hook_code, ARM_FUNCTION_HOOK, ARM_FUNCTION_HOOK_SIZE);
+            memcpy(s.hook_code + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
         }
+#elif __aarch64__
+        memcpy(s.hook_code, ARM_FUNCTION_HOOK, ARM_FUNCTION_HOOK_SIZE);
+        memcpy(s.hook_code + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
 #else
         // TODO: It would be safer to generate an indirect jump to an absolute address since distance might be greater than +/- 2^31
         int32_t jmp_offset = (int64_t)new_func - (int64_t)orig_func - HOOK_SIZE;
 
-        // Change original function to jump to our new one.
-        *orig_func = 0xE9; // JMP
-        *(int32_t*)(orig_func + 1) = jmp_offset;
+        s.hook_code[0] = (int8_t)0xE9; // JMP
+        memcpy(s.hook_code + 1, &jmp_offset, sizeof(jmp_offset));
 #endif
-    }
+        return s;
+    }();
+    return state;
+}
+
+static JSGlobalContextRef create_context(JSContextGroupRef group, JSClassRef global_class)
+{
+    static std::mutex s_mutex;
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    HookState& state = hook_state();
+
+    // One writable window covers unhooking, the original call and rehooking,
+    // instead of a full mprotect/flush round-trip per swap.
+    mprotect((void*)state.page_start, state.code_end - state.page_start, PROT_READ | PROT_WRITE | PROT_EXEC);
+
+    // Restore the original implementation and call it.
+    memcpy(state.orig_func, state.orig_code, HOOK_SIZE);
+    __builtin___clear_cache((char *)state.page_start, (char *)state.code_end);
+    JSGlobalContextRef ctx = JSGlobalContextCreateInGroup(group, global_class);
+
+    // Reinstall the hook for the next context creation (e.g. an RN reload).
+    memcpy(state.orig_func, state.hook_code, HOOK_SIZE);
+    __builtin___clear_cache((char *)state.page_start, (char *)state.code_end);
+    mprotect((void*)state.page_start, state.code_end - state.page_start, PROT_READ | PROT_EXEC);
+
+    // Clear cache from previous instances.
+    RJSInvalidateCaches();
 
-    s_swapped = !s_swapped;
+    RJSInitializeInContext(ctx);
+    realmContextInjected = true;
+    return ctx;
+}
 
-    __builtin___clear_cache((char *)page_start, (char *)code_end);
+static void install_hook()
+{
+    HookState& state = hook_state();
 
-    // Return this region to no longer being writable.
-    mprotect((void*)page_start, code_end - page_start, PROT_READ | PROT_EXEC);
+    mprotect((void*)state.page_start, state.code_end - state.page_start, PROT_READ | PROT_WRITE | PROT_EXEC);
+    memcpy(state.orig_func, state.hook_code, HOOK_SIZE);
+    __builtin___clear_cache((char *)state.page_start, (char *)state.code_end);
+    mprotect((void*)state.page_start, state.code_end - state.page_start, PROT_READ | PROT_EXEC);
 }
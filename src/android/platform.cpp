@@ -21,6 +21,9 @@
 #include <stdarg.h>
 #include <unistd.h>
 #include <cstdio>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/sendfile.h>
 #include <android/asset_manager.h>
 #include <android/log.h>
 
@@ -62,7 +65,57 @@ namespace realm {
 
     }
     
-    void copy_bundled_realm_files()
+    // Kernel-space copy of an uncompressed asset: sendfile() straight from the
+    // APK's file descriptor, never staging the bytes in userspace. Returns
+    // false (with the destination truncated) if the asset is compressed or a
+    // transfer fails, so the caller can fall back to the buffered loop.
+    static bool copy_asset_sendfile(AAsset* asset, int out_fd, const CopyProgressHandler& progress)
+    {
+        off64_t start = 0;
+        off64_t length = 0;
+        int in_fd = AAsset_openFileDescriptor64(asset, &start, &length);
+        if (in_fd < 0) {
+            return false;
+        }
+
+        // Chunked so large seed files still report progress.
+        constexpr uint64_t chunk_size = 8 * 1024 * 1024;
+        uint64_t copied = 0;
+        off64_t offset = start;
+        while (copied < uint64_t(length)) {
+            size_t chunk = size_t(std::min(uint64_t(length) - copied, chunk_size));
+            ssize_t sent = sendfile(out_fd, in_fd, &offset, chunk);
+            if (sent <= 0) {
+                close(in_fd);
+                ftruncate(out_fd, 0);
+                lseek(out_fd, 0, SEEK_SET);
+                return false;
+            }
+            copied += uint64_t(sent);
+            if (progress) {
+                progress(copied, uint64_t(length));
+            }
+        }
+        close(in_fd);
+        return true;
+    }
+
+    static void copy_asset_buffered(AAsset* asset, int out_fd, const CopyProgressHandler& progress)
+    {
+        uint64_t total = uint64_t(AAsset_getLength64(asset));
+        uint64_t copied = 0;
+        char buf[BUFSIZ];
+        int nb_read = 0;
+        while ((nb_read = AAsset_read(asset, buf, BUFSIZ)) > 0) {
+            write(out_fd, buf, size_t(nb_read));
+            copied += uint64_t(nb_read);
+            if (progress) {
+                progress(copied, total);
+            }
+        }
+    }
+
+    void copy_bundled_realm_files_with_progress(const CopyProgressHandler& progress)
     {
         AAssetDir* assetDir = AAssetManager_openDir(s_asset_manager, "");
         const char* filename = nullptr;
@@ -71,17 +124,19 @@ namespace realm {
             if (is_realm_file(filename)) {
                 AAsset* asset = AAssetManager_open(s_asset_manager, filename, AASSET_MODE_STREAMING);
 
-                char buf[BUFSIZ];
-                int nb_read = 0;
-
                 auto dest_filename = s_default_realm_directory + '/' + filename;
                 if (access(dest_filename.c_str(), F_OK ) == -1) {
                     // file doesn't exist, copy
-                    FILE* out = fopen(dest_filename.c_str(), "w");
-                    while ((nb_read = AAsset_read(asset, buf, BUFSIZ)) > 0) {
-                        fwrite(buf, nb_read, 1, out);
+                    int out_fd = open(dest_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+                    if (out_fd >= 0) {
+                        if (!copy_asset_sendfile(asset, out_fd, progress)) {
+                            // compressed asset (no file descriptor) or a failed
+                            // transfer; stream it through a userspace buffer
+                            AAsset_seek64(asset, 0, SEEK_SET);
+                            copy_asset_buffered(asset, out_fd, progress);
+                        }
+                        close(out_fd);
                     }
-                    fclose(out);
                 }
                 AAsset_close(asset);
             }
@@ -89,6 +144,11 @@ namespace realm {
         AAssetDir_close(assetDir);
     }
 
+    void copy_bundled_realm_files()
+    {
+        copy_bundled_realm_files_with_progress(nullptr);
+    }
+
     void remove_realm_files_from_directory(const std::string &directory)
     {
         std::string cmd = "rm " + s_default_realm_directory + "/*.realm " +
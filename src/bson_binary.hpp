@@ -0,0 +1,421 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <realm/object-store/util/bson/bson.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace realm {
+namespace js {
+
+// Codec between bson::Bson and the binary BSON wire format
+// (bsonspec.org/spec.html). This lets function call arguments and results
+// travel between JS and native as raw bytes - the JS side uses the bundled
+// `bson` package's serialize()/deserialize() - instead of being stringified
+// to EJSON on one side and re-parsed on the other.
+//
+// Multi-byte values are little-endian as the spec requires, which matches
+// every platform this binding ships on.
+namespace bson_binary {
+
+namespace detail {
+
+inline void append_bytes(std::string& out, const void* data, size_t size)
+{
+    out.append(static_cast<const char*>(data), size);
+}
+
+template <typename ValueType>
+inline void append_raw(std::string& out, ValueType value)
+{
+    append_bytes(out, &value, sizeof(value));
+}
+
+inline void append_cstring(std::string& out, const std::string& string)
+{
+    if (string.find('\0') != std::string::npos) {
+        throw std::invalid_argument("BSON keys and regular expressions cannot contain null bytes");
+    }
+    out.append(string);
+    out.push_back('\0');
+}
+
+void append_element(std::string& out, const std::string& name, const bson::Bson& value);
+
+inline void append_document(std::string& out, const bson::BsonDocument& document)
+{
+    // The leading total-size field is patched once the contents are known.
+    size_t header = out.size();
+    append_raw<int32_t>(out, 0);
+    for (auto& pair : document) {
+        append_element(out, pair.first, pair.second);
+    }
+    out.push_back('\0');
+    int32_t total_size = int32_t(out.size() - header);
+    memcpy(&out[header], &total_size, sizeof(total_size));
+}
+
+inline void append_array(std::string& out, const bson::BsonArray& array)
+{
+    size_t header = out.size();
+    append_raw<int32_t>(out, 0);
+    size_t index = 0;
+    for (auto& entry : array) {
+        append_element(out, std::to_string(index++), entry);
+    }
+    out.push_back('\0');
+    int32_t total_size = int32_t(out.size() - header);
+    memcpy(&out[header], &total_size, sizeof(total_size));
+}
+
+inline void append_string(std::string& out, const std::string& string)
+{
+    append_raw<int32_t>(out, int32_t(string.size() + 1));
+    out.append(string);
+    out.push_back('\0');
+}
+
+inline int from_hex_digit(char digit)
+{
+    if (digit >= '0' && digit <= '9') {
+        return digit - '0';
+    }
+    if (digit >= 'a' && digit <= 'f') {
+        return digit - 'a' + 10;
+    }
+    if (digit >= 'A' && digit <= 'F') {
+        return digit - 'A' + 10;
+    }
+    throw std::invalid_argument("Invalid hexadecimal digit in BSON value");
+}
+
+inline void append_element(std::string& out, const std::string& name, const bson::Bson& value)
+{
+    using Type = bson::Bson::Type;
+    switch (value.type()) {
+        case Type::Null:
+            out.push_back('\x0a');
+            append_cstring(out, name);
+            break;
+        case Type::Bool:
+            out.push_back('\x08');
+            append_cstring(out, name);
+            out.push_back(static_cast<bool>(value) ? '\x01' : '\x00');
+            break;
+        case Type::Int32:
+            out.push_back('\x10');
+            append_cstring(out, name);
+            append_raw<int32_t>(out, static_cast<int32_t>(value));
+            break;
+        case Type::Int64:
+            out.push_back('\x12');
+            append_cstring(out, name);
+            append_raw<int64_t>(out, static_cast<int64_t>(value));
+            break;
+        case Type::Double:
+            out.push_back('\x01');
+            append_cstring(out, name);
+            append_raw<double>(out, static_cast<double>(value));
+            break;
+        case Type::String:
+            out.push_back('\x02');
+            append_cstring(out, name);
+            append_string(out, static_cast<std::string>(value));
+            break;
+        case Type::Binary: {
+            out.push_back('\x05');
+            append_cstring(out, name);
+            auto& data = value.operator const std::vector<char>&();
+            append_raw<int32_t>(out, int32_t(data.size()));
+            out.push_back('\x00'); // generic subtype
+            append_bytes(out, data.data(), data.size());
+            break;
+        }
+        case Type::Datetime: {
+            out.push_back('\x09');
+            append_cstring(out, name);
+            Timestamp timestamp = static_cast<Timestamp>(value);
+            int64_t millis = timestamp.get_seconds() * 1000 + timestamp.get_nanoseconds() / 1000000;
+            append_raw<int64_t>(out, millis);
+            break;
+        }
+        case Type::Timestamp: {
+            out.push_back('\x11');
+            append_cstring(out, name);
+            MongoTimestamp timestamp = static_cast<MongoTimestamp>(value);
+            append_raw<uint32_t>(out, timestamp.increment);
+            append_raw<uint32_t>(out, timestamp.seconds);
+            break;
+        }
+        case Type::ObjectId: {
+            out.push_back('\x07');
+            append_cstring(out, name);
+            std::string hex = static_cast<ObjectId>(value).to_string();
+            for (size_t i = 0; i < 24; i += 2) {
+                out.push_back(char((from_hex_digit(hex[i]) << 4) | from_hex_digit(hex[i + 1])));
+            }
+            break;
+        }
+        case Type::Decimal128: {
+            out.push_back('\x13');
+            append_cstring(out, name);
+            Decimal128 decimal = static_cast<Decimal128>(value);
+            append_bytes(out, decimal.raw(), 16);
+            break;
+        }
+        case Type::Uuid: {
+            // UUIDs travel as binary subtype 4, as the JS bson library emits them.
+            out.push_back('\x05');
+            append_cstring(out, name);
+            auto bytes = static_cast<UUID>(value).to_bytes();
+            append_raw<int32_t>(out, int32_t(bytes.size()));
+            out.push_back('\x04');
+            append_bytes(out, bytes.data(), bytes.size());
+            break;
+        }
+        case Type::RegularExpression: {
+            out.push_back('\x0b');
+            append_cstring(out, name);
+            auto regex = value.operator const bson::RegularExpression&();
+            append_cstring(out, regex.pattern());
+            append_cstring(out, regex.options());
+            break;
+        }
+        case Type::MinKey:
+            out.push_back('\xff');
+            append_cstring(out, name);
+            break;
+        case Type::MaxKey:
+            out.push_back('\x7f');
+            append_cstring(out, name);
+            break;
+        case Type::Document:
+            out.push_back('\x03');
+            append_cstring(out, name);
+            append_document(out, value.operator const bson::BsonDocument&());
+            break;
+        case Type::Array:
+            out.push_back('\x04');
+            append_cstring(out, name);
+            append_array(out, value.operator const bson::BsonArray&());
+            break;
+        default:
+            throw std::invalid_argument("Unsupported BSON type for binary encoding");
+    }
+}
+
+// Bounds-checked cursor over an incoming BSON buffer.
+class Reader {
+public:
+    Reader(const char* data, size_t size)
+    : m_data(data)
+    , m_size(size)
+    {
+    }
+
+    bson::BsonDocument read_document()
+    {
+        size_t start = m_offset;
+        int32_t total_size = read_raw<int32_t>();
+        if (total_size < 5 || start + size_t(total_size) > m_size) {
+            throw std::invalid_argument("Malformed BSON: bad document size");
+        }
+        size_t end = start + size_t(total_size);
+
+        bson::BsonDocument document;
+        while (m_offset < end - 1) {
+            char type = read_raw<char>();
+            std::string name = read_cstring();
+            document[name] = read_value(type);
+        }
+        if (m_offset != end - 1 || read_raw<char>() != '\0') {
+            throw std::invalid_argument("Malformed BSON: bad document terminator");
+        }
+        return document;
+    }
+
+private:
+    const char* m_data;
+    size_t m_size;
+    size_t m_offset = 0;
+
+    const char* consume(size_t count)
+    {
+        if (m_offset + count > m_size) {
+            throw std::invalid_argument("Malformed BSON: truncated value");
+        }
+        const char* position = m_data + m_offset;
+        m_offset += count;
+        return position;
+    }
+
+    template <typename ValueType>
+    ValueType read_raw()
+    {
+        ValueType value;
+        memcpy(&value, consume(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    std::string read_cstring()
+    {
+        const char* start = m_data + m_offset;
+        const char* terminator = static_cast<const char*>(memchr(start, '\0', m_size - m_offset));
+        if (!terminator) {
+            throw std::invalid_argument("Malformed BSON: unterminated string");
+        }
+        std::string string(start, terminator);
+        m_offset += string.size() + 1;
+        return string;
+    }
+
+    std::string read_string()
+    {
+        int32_t length = read_raw<int32_t>();
+        if (length < 1) {
+            throw std::invalid_argument("Malformed BSON: bad string length");
+        }
+        const char* bytes = consume(size_t(length));
+        if (bytes[length - 1] != '\0') {
+            throw std::invalid_argument("Malformed BSON: unterminated string");
+        }
+        return std::string(bytes, size_t(length) - 1);
+    }
+
+    bson::BsonArray read_array()
+    {
+        // Arrays are documents keyed "0", "1", ...; the keys only carry order.
+        bson::BsonArray array;
+        for (auto& pair : read_document()) {
+            array.push_back(pair.second);
+        }
+        return array;
+    }
+
+    bson::Bson read_value(char type)
+    {
+        switch (type) {
+            case '\x0a':
+                return bson::Bson();
+            case '\x08':
+                return bson::Bson(read_raw<char>() != '\0');
+            case '\x10':
+                return bson::Bson(read_raw<int32_t>());
+            case '\x12':
+                return bson::Bson(read_raw<int64_t>());
+            case '\x01':
+                return bson::Bson(read_raw<double>());
+            case '\x02':
+                return bson::Bson(read_string());
+            case '\x05': {
+                int32_t length = read_raw<int32_t>();
+                if (length < 0) {
+                    throw std::invalid_argument("Malformed BSON: bad binary length");
+                }
+                char subtype = read_raw<char>();
+                const char* bytes = consume(size_t(length));
+                if (subtype == '\x04' && length == 16) {
+                    UUID::UUIDBytes uuid_bytes;
+                    memcpy(uuid_bytes.data(), bytes, uuid_bytes.size());
+                    return bson::Bson(UUID(uuid_bytes));
+                }
+                return bson::Bson(std::vector<char>(bytes, bytes + length));
+            }
+            case '\x09': {
+                int64_t millis = read_raw<int64_t>();
+                int64_t seconds = millis / 1000;
+                int32_t nanoseconds = int32_t(millis % 1000) * 1000000;
+                if (nanoseconds < 0) {
+                    seconds -= 1;
+                    nanoseconds += 1000000000;
+                }
+                return bson::Bson(Timestamp(seconds, nanoseconds));
+            }
+            case '\x11': {
+                uint32_t increment = read_raw<uint32_t>();
+                uint32_t seconds = read_raw<uint32_t>();
+                return bson::Bson(MongoTimestamp(seconds, increment));
+            }
+            case '\x07': {
+                static const char hex_digits[] = "0123456789abcdef";
+                const char* bytes = consume(12);
+                char hex[24];
+                for (size_t i = 0; i < 12; i++) {
+                    hex[2 * i] = hex_digits[(bytes[i] >> 4) & 0xf];
+                    hex[2 * i + 1] = hex_digits[bytes[i] & 0xf];
+                }
+                return bson::Bson(ObjectId(std::string(hex, 24).c_str()));
+            }
+            case '\x13': {
+                Decimal128 decimal;
+                memcpy(decimal.raw(), consume(16), 16);
+                return bson::Bson(decimal);
+            }
+            case '\x0b': {
+                std::string pattern = read_cstring();
+                std::string options = read_cstring();
+                return bson::Bson(bson::RegularExpression(pattern, options));
+            }
+            case '\xff':
+                return bson::Bson(bson::MinKey());
+            case '\x7f':
+                return bson::Bson(bson::MaxKey());
+            case '\x03':
+                return bson::Bson(read_document());
+            case '\x04':
+                return bson::Bson(read_array());
+            default:
+                throw std::invalid_argument("Unsupported BSON type for binary decoding");
+        }
+    }
+};
+
+} // namespace detail
+
+/// Encodes a BSON document (or array, per the spec the only legal top-level
+/// values) into its binary representation.
+inline std::string encode(const bson::Bson& value)
+{
+    std::string out;
+    if (value.type() == bson::Bson::Type::Document) {
+        detail::append_document(out, value.operator const bson::BsonDocument&());
+    }
+    else if (value.type() == bson::Bson::Type::Array) {
+        detail::append_array(out, value.operator const bson::BsonArray&());
+    }
+    else {
+        throw std::invalid_argument("Only documents and arrays can be top-level BSON values");
+    }
+    return out;
+}
+
+/// Decodes a binary BSON document.
+inline bson::Bson decode(const char* data, size_t size)
+{
+    detail::Reader reader(data, size);
+    return bson::Bson(reader.read_document());
+}
+
+} // namespace bson_binary
+} // namespace js
+} // namespace realm
@@ -21,4 +21,24 @@ struct IOCollection {
     virtual realm::Mixed get(std::string) = 0;
     virtual void remove(std::string) = 0;
     virtual bool contains(std::string) = 0;
-};
\ No newline at end of file
+
+    // Batch entry points keyed by StringData. The defaults forward to the
+    // string-keyed virtuals above so existing implementations keep working
+    // unchanged; implementations backed by core storage should override these
+    // to avoid the per-access heap-allocated key and to amortize virtual
+    // dispatch over a whole batch. Pointer/count pairs are used instead of
+    // std::span, which is not available pre-C++20. Single-access StringData
+    // overloads are intentionally not provided: they would make calls with
+    // string literals ambiguous.
+    virtual void get_many(const realm::StringData* keys, size_t count, realm::Mixed* out) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = get(std::string(keys[i]));
+        }
+    }
+
+    virtual void set_many(const realm::StringData* keys, const realm::Mixed* values, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            set(std::string(keys[i]), values[i]);
+        }
+    }
+};
@@ -24,6 +24,40 @@
 namespace realm {
 namespace js {
 
+// Builds identically-shaped plain objects repeatedly. The property names are
+// interned once — per shape, not per instance — so stamping a payload performs
+// one property store per value instead of re-creating every key string; on
+// JavaScriptCore the keys stay retained JSStringRefs for the shape's lifetime.
+// Instances are deliberately not pooled: payloads escape to user callbacks,
+// which may retain them indefinitely, so each stamp returns a fresh object
+// sharing only the keys.
+template <typename VM>
+class PlainObjectShape {
+    using ContextType = typename VM::Context;
+    using ObjectType = typename VM::Object;
+    using ValueType = typename VM::Value;
+
+   public:
+    PlainObjectShape(std::initializer_list<const char*> names) {
+        keys.reserve(names.size());
+        for (auto name : names) {
+            keys.emplace_back(name);
+        }
+    }
+
+    ObjectType stamp(ContextType context, std::initializer_list<ValueType> values) {
+        ObjectType object = js::Object<VM>::create_empty(context);
+        size_t index = 0;
+        for (const auto& value : values) {
+            js::Object<VM>::set_property(context, object, keys[index++], value);
+        }
+        return object;
+    }
+
+   private:
+    std::vector<js::String<VM>> keys;
+};
+
 template <
         typename VM,
         typename GetterSetters = EmptyGetterSetters,
@@ -41,7 +75,12 @@ struct JSObject : public ObjectObserver {
 
     std::unique_ptr<Builder> builder;
     std::unique_ptr<Collection> collection;
-    std::vector<std::unique_ptr<Subscriber>> subscribers;
+    // RCU-style subscriber list: delivery iterates an immutable snapshot while
+    // subscribe/remove replace the vector wholesale, so listeners added or
+    // removed during a notification (the React effect-cleanup pattern) never
+    // invalidate the iteration and never serialize against dispatch.
+    using SubscriberList = std::vector<std::shared_ptr<Subscriber>>;
+    std::shared_ptr<const SubscriberList> subscribers = std::make_shared<SubscriberList>();
     common::JavascriptObject<GetterSetters> javascript_object;
 
    public:
@@ -73,28 +112,42 @@ struct JSObject : public ObjectObserver {
     }
 
     void subscribe(std::unique_ptr<Subscriber> subscriber) {
-        subscribers.push_back(std::move(subscriber));
+        auto next = std::make_shared<SubscriberList>(*std::atomic_load(&subscribers));
+        next->push_back(std::move(subscriber));
+        std::atomic_store(&subscribers, std::shared_ptr<const SubscriberList>(std::move(next)));
         watch_collection();
     }
 
     void remove_subscription(std::unique_ptr<Subscriber> subscriber) {
-        int index = -1;
-        for (auto const& candidate : subscribers) {
-            index++;
-            if (candidate->equals(subscriber)) {
-                subscribers.erase(subscribers.begin() + index);
+        auto next = std::make_shared<SubscriberList>(*std::atomic_load(&subscribers));
+        for (auto it = next->begin(); it != next->end(); ++it) {
+            if ((*it)->equals(subscriber)) {
+                next->erase(it);
                 break;
             }
         }
+        std::atomic_store(&subscribers, std::shared_ptr<const SubscriberList>(std::move(next)));
     }
 
-    void unsubscribe_all() { subscribers.clear(); }
+    void unsubscribe_all() {
+        std::atomic_store(&subscribers,
+                          std::shared_ptr<const SubscriberList>(std::make_shared<SubscriberList>()));
+    }
 
     void notify_subscribers(collection::Notification notification){
-        HANDLESCOPE(context)
-        for (auto& subscriber : subscribers) {
-            subscriber->notify(javascript_object.get(), notification.change_set);
-        }
+        // While a batch is open (the Realm is advancing to a new version),
+        // this defers the VM entry so all collections touched by the write
+        // deliver in one go; otherwise it runs immediately.
+        NotificationBatcher::enqueue([this, notification = std::move(notification)]() mutable {
+            HANDLESCOPE(context)
+            // Snapshot taken once per delivery; concurrent (or reentrant)
+            // subscribe/remove calls swap in a new list and leave this
+            // iteration untouched.
+            auto snapshot = std::atomic_load(&subscribers);
+            for (auto& subscriber : *snapshot) {
+                subscriber->notify(javascript_object.get(), notification.change_set);
+            }
+        });
     }
 
     template <typename Realm_ChangeSet>
@@ -17,9 +17,83 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #pragma once
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "tracing.hpp"
+
+struct Subscriber;
 
 struct ObjectObserver {
     virtual void subscribe(std::unique_ptr<Subscriber>) = 0;
     virtual void remove_subscription(std::unique_ptr<Subscriber>) = 0;
     virtual void unsubscribe_all() = 0;
 };
+
+/*
+ *  Coalesces subscriber deliveries produced while a Realm advances to a new
+ *  version. A delivery enqueued outside an open batch runs immediately,
+ *  preserving the old behaviour. While a batch is open (see BatchGuard) every
+ *  observed collection appends its delivery instead of entering the VM, and
+ *  the guard flushes them back to back in one native frame when it unwinds —
+ *  so a write touching N observed collections costs one JS entry, not N.
+ */
+class NotificationBatcher {
+   public:
+    using Delivery = std::function<void()>;
+
+    static void enqueue(Delivery delivery) {
+        auto &state = instance();
+        if (state.depth == 0) {
+            realm::js::tracing::ScopedTraceEvent trace("Realm.notification");
+            delivery();
+            return;
+        }
+        state.pending.push_back(std::move(delivery));
+    }
+
+    /* Deliveries queued behind the currently open batch on this thread, for
+     * memory accounting. */
+    static size_t pending_count() { return instance().pending.size(); }
+
+    /* Opens a batch for the current scope; nested guards flush only when the
+     * outermost one unwinds. */
+    struct BatchGuard {
+        BatchGuard() { instance().depth++; }
+
+        BatchGuard(const BatchGuard &) = delete;
+        BatchGuard &operator=(const BatchGuard &) = delete;
+
+        ~BatchGuard() {
+            auto &state = instance();
+            if (state.depth > 1) {
+                state.depth--;
+                return;
+            }
+            /* Drain with the batch still open so follow-up work enqueued by a
+             * delivery joins this flush instead of entering the VM alone. */
+            std::vector<Delivery> batch;
+            while (!state.pending.empty()) {
+                batch.swap(state.pending);
+                for (auto &delivery : batch) {
+                    realm::js::tracing::ScopedTraceEvent trace("Realm.notification");
+                    delivery();
+                }
+                batch.clear();
+            }
+            state.depth = 0;
+        }
+    };
+
+   private:
+    struct State {
+        int depth = 0;
+        std::vector<Delivery> pending;
+    };
+
+    static State &instance() {
+        static thread_local State state;
+        return state;
+    }
+};
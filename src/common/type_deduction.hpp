@@ -16,8 +16,8 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 #pragma once
-#include <iostream>
-#include <map>
+#include <string>
+#include <type_traits>
 
 #include "js_types.hpp"
 #include "types.hpp"
@@ -27,52 +27,114 @@
 namespace realm {
 namespace js {
 
+/*
+ * Static mapping between realm types and their JavaScript names. The table
+ * is constexpr so the per-value conversions on the dictionary/mixed paths
+ * resolve through a short scan of static data instead of heap-allocated map
+ * lookups; name matching is case-insensitive, covering the camel-case and
+ * lower-case spellings the old maps enumerated.
+ */
 class GenericTypeDeductionImpl {
    private:
-    std::map<types::Type, std::string> realm_to_js_map;
-    std::map<std::string, types::Type> js_to_realm_map;
-
-    auto reverse_deduction_types_map() {
-        std::map<std::string, types::Type> ret;
-        for (auto& [type, key] : realm_to_js_map) {
-            ret[key] = type;  // camel_case version.
-            std::string lower_case_key;
-            // in-place lower case, we want to support multiple variation of the
-            // types written names.
-            std::transform(key.begin(), key.end(), key.begin(),
-                           [](unsigned char chr) { return std::tolower(chr); });
-            ret[key] = type;
-        }
-        return ret;
+    struct TypeName {
+        types::Type type;
+        const char* name;
+    };
+
+    static constexpr TypeName s_type_names[] = {
+        {types::String, "String"},       {types::Integer, "Int"},
+        {types::Float, "Float"},         {types::Double, "Double"},
+        {types::Decimal, "Decimal128"},  {types::Boolean, "Bool"},
+        {types::ObjectId, "ObjectId"},   {types::Object, "Object"},
+        {types::UUID, "UUID"},
+        {types::Undefined, "Undefined"}, {types::Null, "Null"}};
+
+    static constexpr char to_lower(char chr) {
+        return chr >= 'A' && chr <= 'Z' ? static_cast<char>(chr - 'A' + 'a') : chr;
     }
 
-   public:
-    GenericTypeDeductionImpl() {
-        realm_to_js_map = {
-            {types::String, "String"},       {types::Integer, "Int"},
-            {types::Float, "Float"},         {types::Double, "Double"},
-            {types::Decimal, "Decimal128"},  {types::Boolean, "Bool"},
-            {types::ObjectId, "ObjectId"},   {types::Object, "Object"},
-            {types::UUID, "UUID"},       {types::Object, "Object"},
-            {types::Undefined, "Undefined"}, {types::Null, "Null"}};
-        js_to_realm_map = reverse_deduction_types_map();
+    static constexpr bool names_equal(const char* name, const char* candidate) {
+        size_t index = 0;
+        for (; name[index] && candidate[index]; index++) {
+            if (to_lower(name[index]) != to_lower(candidate[index])) {
+                return false;
+            }
+        }
+        return name[index] == candidate[index];
     }
 
+   public:
     static GenericTypeDeductionImpl& get_instance() {
         static GenericTypeDeductionImpl instance;
         return instance;
     }
 
+    static constexpr types::Type type_for_name(const char* name) {
+        for (auto& entry : s_type_names) {
+            if (names_equal(entry.name, name)) {
+                return entry.type;
+            }
+        }
+        return types::NotImplemented;
+    }
+
     bool realm_type_exist(std::string const& type) {
-        return js_to_realm_map.find(type) != js_to_realm_map.end();
+        return type_for_name(type.c_str()) != types::NotImplemented;
     }
 
     types::Type realm_type(std::string const& type) {
-        return js_to_realm_map[type];
+        return type_for_name(type.c_str());
     }
 
     std::string javascript_type(types::Type value) {
-        return realm_to_js_map[value];
+        for (auto& entry : s_type_names) {
+            if (entry.type == value) {
+                return entry.name;
+            }
+        }
+        return "";
+    }
+
+    /*
+     * Compile-time mapping for statically-known core types, letting
+     * templated conversion code resolve the type tag without any runtime
+     * dispatch at all.
+     */
+    template <typename T>
+    static constexpr types::Type from() {
+        if constexpr (std::is_same_v<T, bool>) {
+            return types::Boolean;
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            return types::Integer;
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            return types::Float;
+        }
+        else if constexpr (std::is_same_v<T, double>) {
+            return types::Double;
+        }
+        else if constexpr (std::is_same_v<T, StringData> || std::is_same_v<T, std::string>) {
+            return types::String;
+        }
+        else if constexpr (std::is_same_v<T, BinaryData>) {
+            return types::Binary;
+        }
+        else if constexpr (std::is_same_v<T, Timestamp>) {
+            return types::Timestamp;
+        }
+        else if constexpr (std::is_same_v<T, Decimal128>) {
+            return types::Decimal;
+        }
+        else if constexpr (std::is_same_v<T, ObjectId>) {
+            return types::ObjectId;
+        }
+        else if constexpr (std::is_same_v<T, UUID>) {
+            return types::UUID;
+        }
+        else {
+            return types::NotImplemented;
+        }
     }
 
     template <typename MixedValue>
@@ -111,7 +173,7 @@ class GenericTypeDeductionImpl {
             return types::Undefined;
         }
         if (Value::is_array_buffer(context, value) ||
-            Value::is_array_buffer(context, value)) {
+            Value::is_array_buffer_view(context, value)) {
             return types::Binary;
         }
         if (Value::is_decimal128(context, value)) {
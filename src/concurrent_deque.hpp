@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
@@ -35,23 +36,6 @@ public:
         return do_pop_back();
     }
 
-    T pop_if(std::function<bool(const T&)> predicate) {
-        std::unique_lock<std::mutex> lock(m_mutex);
-
-        for (auto it = m_deque.begin(); it != m_deque.end();) {
-            if (predicate(*it)) {
-                T item = std::move(*it);
-                m_deque.erase(it);
-                return item;
-            }
-            else {
-                ++it;
-            }
-        }
-
-        return nullptr;
-    }
-
     util::Optional<T> try_pop_back(size_t timeout) {
         std::unique_lock<std::mutex> lock(m_mutex);
         m_condition.wait_for(lock, std::chrono::milliseconds(timeout),
@@ -90,4 +74,106 @@ private:
     }
 };
 
+// Multi-producer single-consumer queue with lock-free pushes (an intrusive
+// linked list in the style of Vyukov's MPSC queue). Producers never take a
+// lock; the mutex and condition variable exist only so the consumer can block
+// while the queue is empty, and producers touch them only when a consumer is
+// actually waiting. Items are delivered in FIFO order; only the single
+// consumer thread may pop.
+template <typename T>
+class ConcurrentMPSCQueue {
+public:
+    ConcurrentMPSCQueue() {
+        Node* stub = new Node;
+        m_head.store(stub);
+        m_tail = stub;
+    }
+
+    ConcurrentMPSCQueue(const ConcurrentMPSCQueue&) = delete;
+    ConcurrentMPSCQueue& operator=(const ConcurrentMPSCQueue&) = delete;
+
+    ~ConcurrentMPSCQueue() {
+        Node* node = m_tail;
+        while (node) {
+            Node* next = node->next.load();
+            delete node;
+            node = next;
+        }
+    }
+
+    void push(T&& item) {
+        Node* node = new Node(std::move(item));
+        Node* prev = m_head.exchange(node);
+        prev->next.store(node);
+
+        if (m_consumer_waiting.load()) {
+            std::lock_guard<std::mutex> lock(m_wait_mutex);
+            m_condition.notify_one();
+        }
+    }
+
+    T pop() {
+        while (true) {
+            if (auto item = do_try_pop()) {
+                return std::move(*item);
+            }
+            std::unique_lock<std::mutex> lock(m_wait_mutex);
+            m_consumer_waiting.store(true);
+            m_condition.wait(lock, [this] { return peek() != nullptr; });
+            m_consumer_waiting.store(false);
+        }
+    }
+
+    util::Optional<T> try_pop(size_t timeout) {
+        if (auto item = do_try_pop()) {
+            return item;
+        }
+        if (timeout != 0) {
+            std::unique_lock<std::mutex> lock(m_wait_mutex);
+            m_consumer_waiting.store(true);
+            m_condition.wait_for(lock, std::chrono::milliseconds(timeout),
+                                 [this] { return peek() != nullptr; });
+            m_consumer_waiting.store(false);
+        }
+        return do_try_pop();
+    }
+
+    bool empty() {
+        return peek() == nullptr;
+    }
+
+private:
+    struct Node {
+        Node() = default;
+        Node(T&& item) : value(std::move(item)) {}
+
+        T value;
+        std::atomic<Node*> next{nullptr};
+    };
+
+    // producers swap themselves in at the head; the consumer drains from the tail
+    std::atomic<Node*> m_head;
+    Node* m_tail; // owned by the consumer thread, always points at the last consumed (stub) node
+
+    std::atomic<bool> m_consumer_waiting{false};
+    std::condition_variable m_condition;
+    std::mutex m_wait_mutex;
+
+    Node* peek() {
+        return m_tail->next.load();
+    }
+
+    util::Optional<T> do_try_pop() {
+        Node* next = peek();
+        if (!next) {
+            return util::none;
+        }
+        // the popped value lives in the successor node, which becomes the new stub
+        util::Optional<T> item = std::move(next->value);
+        delete m_tail;
+        m_tail = next;
+        return item;
+    }
+};
+
 } // realm
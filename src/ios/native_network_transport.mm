@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include "../native_network_transport.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+
+#import <Foundation/Foundation.h>
+
+namespace {
+using namespace realm;
+
+NSString *to_http_method(app::HttpMethod method)
+{
+    switch (method) {
+        case app::HttpMethod::get:   return @"GET";
+        case app::HttpMethod::put:   return @"PUT";
+        case app::HttpMethod::post:  return @"POST";
+        case app::HttpMethod::del:   return @"DELETE";
+        case app::HttpMethod::patch: return @"PATCH";
+        default: throw std::runtime_error("Unknown HttpMethod argument");
+    }
+}
+
+// NSURLSession maintains a per-host pool of keep-alive connections; routing
+// every request through the shared session is what provides the pooling.
+// Completion handlers run on the session's own queue, never the JS thread.
+struct AppleNetworkTransport : public app::GenericNetworkTransport {
+    void send_request_to_server(app::Request request,
+                                std::function<void(const app::Response)> completion_callback) override
+    {
+        NSMutableURLRequest *url_request = [NSMutableURLRequest
+            requestWithURL:[NSURL URLWithString:@(request.url.c_str())]];
+        url_request.HTTPMethod = to_http_method(request.method);
+        url_request.timeoutInterval = request.timeout_ms / 1000.0;
+        for (auto &header : request.headers) {
+            [url_request setValue:@(header.second.c_str()) forHTTPHeaderField:@(header.first.c_str())];
+        }
+        if (!request.body.empty()) {
+            url_request.HTTPBody = [NSData dataWithBytes:request.body.data() length:request.body.size()];
+        }
+
+        auto callback = std::make_shared<std::function<void(const app::Response)>>(std::move(completion_callback));
+        NSURLSessionDataTask *task = [[NSURLSession sharedSession]
+            dataTaskWithRequest:url_request
+              completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
+                  int http_status_code = 0;
+                  int custom_status_code = 0;
+                  std::map<std::string, std::string> headers;
+                  std::string body;
+
+                  if (error) {
+                      custom_status_code = -1;
+                      body = error.localizedDescription.UTF8String;
+                  }
+                  else {
+                      NSHTTPURLResponse *http_response = (NSHTTPURLResponse *)response;
+                      http_status_code = static_cast<int>(http_response.statusCode);
+                      [http_response.allHeaderFields enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSString *value, BOOL *) {
+                          headers.emplace(key.UTF8String, value.UTF8String);
+                      }];
+                      if (data) {
+                          body = std::string(static_cast<const char *>(data.bytes), data.length);
+                      }
+                  }
+
+                  (*callback)(app::Response{http_status_code, custom_status_code, headers, body});
+              }];
+        [task resume];
+    }
+};
+
+// Register at load time so the factory is in place before any App is built.
+const bool s_transport_registered = [] {
+    js::native_transport_factory = []() -> std::unique_ptr<app::GenericNetworkTransport> {
+        return std::make_unique<AppleNetworkTransport>();
+    };
+    return true;
+}();
+
+} // anonymous namespace
@@ -20,9 +20,14 @@
 
 #include <realm/util/to_string.hpp>
 
+#include <mutex>
+#include <set>
 #include <string>
 #include <stdarg.h>
 #include <stdio.h>
+#include <copyfile.h>
+#include <sys/clonefile.h>
+#include <sys/stat.h>
 
 #import <Foundation/Foundation.h>
 
@@ -37,42 +42,61 @@ namespace realm {
 
 std::string default_realm_file_directory()
 {
-    std::string ret;
-    @autoreleasepool {
+    // The search path (and the bundle-identifier subdirectory on macOS) is
+    // fixed for the lifetime of the process, so resolve it once.
+    static const std::string s_directory = [] {
+        std::string ret;
+        @autoreleasepool {
 #if TARGET_OS_IPHONE
-        // On iOS the Documents directory isn't user-visible, so put files there
-        NSString *path = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES)[0];
+            // On iOS the Documents directory isn't user-visible, so put files there
+            NSString *path = NSSearchPathForDirectoriesInDomains(NSDocumentDirectory, NSUserDomainMask, YES)[0];
 #else
-        // On OS X it is, so put files in Application Support. If we aren't running
-        // in a sandbox, put it in a subdirectory based on the bundle identifier
-        // to avoid accidentally sharing files between applications
-        NSString *path = NSSearchPathForDirectoriesInDomains(NSApplicationSupportDirectory, NSUserDomainMask, YES)[0];
-        if (![[NSProcessInfo processInfo] environment][@"APP_SANDBOX_CONTAINER_ID"]) {
-            NSString *identifier = [[NSBundle mainBundle] bundleIdentifier];
-            if ([identifier length] == 0) {
-                identifier = [[[NSBundle mainBundle] executablePath] lastPathComponent];
-            }
-            path = [path stringByAppendingPathComponent:identifier];
+            // On OS X it is, so put files in Application Support. If we aren't running
+            // in a sandbox, put it in a subdirectory based on the bundle identifier
+            // to avoid accidentally sharing files between applications
+            NSString *path = NSSearchPathForDirectoriesInDomains(NSApplicationSupportDirectory, NSUserDomainMask, YES)[0];
+            if (![[NSProcessInfo processInfo] environment][@"APP_SANDBOX_CONTAINER_ID"]) {
+                NSString *identifier = [[NSBundle mainBundle] bundleIdentifier];
+                if ([identifier length] == 0) {
+                    identifier = [[[NSBundle mainBundle] executablePath] lastPathComponent];
+                }
+                path = [path stringByAppendingPathComponent:identifier];
 
-            // create directory
-            [[NSFileManager defaultManager] createDirectoryAtPath:path
-                                      withIntermediateDirectories:YES
-                                                       attributes:nil
-                                                            error:nil];
-        }
+                // create directory
+                [[NSFileManager defaultManager] createDirectoryAtPath:path
+                                          withIntermediateDirectories:YES
+                                                           attributes:nil
+                                                                error:nil];
+            }
 #endif
-        ret = path.UTF8String;
-    }
-    return ret;
+            ret = path.UTF8String;
+        }
+        return ret;
+    }();
+    return s_directory;
 }
 
 void ensure_directory_exists_for_file(const std::string &fileName)
 {
+    // Remember directories already ensured so that opening many Realms under
+    // the same directory stats it only once per process.
+    static std::mutex s_mutex;
+    static std::set<std::string> s_ensured;
+
     @autoreleasepool {
         NSString *docsDir = [@(fileName.c_str()) stringByDeletingLastPathComponent];
         NSFileManager *manager = [NSFileManager defaultManager];
 
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            if (s_ensured.count(docsDir.UTF8String)) {
+                return;
+            }
+        }
+
         if ([manager fileExistsAtPath:docsDir]) {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            s_ensured.insert(docsDir.UTF8String);
             return;
         }
 
@@ -80,10 +104,13 @@ void ensure_directory_exists_for_file(const std::string &fileName)
         if (![manager createDirectoryAtPath:docsDir withIntermediateDirectories:YES attributes:nil error:&error]) {
             throw std::runtime_error(util::format("Failed to create directory \"%1\": %2", docsDir.UTF8String, error_description(error).UTF8String));
         }
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_ensured.insert(docsDir.UTF8String);
     }
 }
 
-void copy_bundled_realm_files()
+void copy_bundled_realm_files_with_progress(const CopyProgressHandler& progress)
 {
     @autoreleasepool {
         NSString *docsDir = @(default_realm_file_directory().c_str());
@@ -100,16 +127,61 @@ void copy_bundled_realm_files()
                     continue;
                 }
 
-                NSError *error = nil;
-                if (![manager copyItemAtPath:[resourcePath stringByAppendingPathComponent:path] toPath:docsPath error:&error]) {
+                NSString *srcPath = [resourcePath stringByAppendingPathComponent:path];
+
+                // On APFS a clone is a metadata-only operation regardless of
+                // file size; the data blocks are shared copy-on-write.
+                if (clonefile(srcPath.fileSystemRepresentation, docsPath.fileSystemRepresentation, 0) == 0) {
+                    if (progress) {
+                        struct stat info;
+                        uint64_t size = stat(docsPath.fileSystemRepresentation, &info) == 0 ? uint64_t(info.st_size) : 0;
+                        progress(size, size);
+                    }
+                    continue;
+                }
+
+                // Non-APFS volume or cross-volume copy; stream with copyfile,
+                // reporting bytes through its status callback.
+                struct Context {
+                    const CopyProgressHandler* progress;
+                    uint64_t total;
+                };
+                struct stat info;
+                Context context{progress ? &progress : nullptr,
+                                stat(srcPath.fileSystemRepresentation, &info) == 0 ? uint64_t(info.st_size) : 0};
+
+                copyfile_state_t state = copyfile_state_alloc();
+                if (context.progress) {
+                    copyfile_callback_t callback = [](int what, int stage, copyfile_state_t state,
+                                                      const char*, const char*, void* raw_context) -> int {
+                        if (what == COPYFILE_COPY_DATA && stage == COPYFILE_PROGRESS) {
+                            off_t copied = 0;
+                            copyfile_state_get(state, COPYFILE_STATE_COPIED, &copied);
+                            auto* context = static_cast<Context*>(raw_context);
+                            (*context->progress)(uint64_t(copied), context->total);
+                        }
+                        return COPYFILE_CONTINUE;
+                    };
+                    copyfile_state_set(state, COPYFILE_STATE_STATUS_CB, (const void*)callback);
+                    copyfile_state_set(state, COPYFILE_STATE_STATUS_CTX, &context);
+                }
+                int result = copyfile(srcPath.fileSystemRepresentation, docsPath.fileSystemRepresentation,
+                                      state, COPYFILE_ALL);
+                copyfile_state_free(state);
+                if (result != 0) {
                     throw std::runtime_error(util::format("Failed to copy file from \"%1\" to \"%2\": %3",
-                                                          path.UTF8String, docsPath.UTF8String, error_description(error).UTF8String));
+                                                          path.UTF8String, docsPath.UTF8String, strerror(errno)));
                 }
             }
         }
     }
 }
 
+void copy_bundled_realm_files()
+{
+    copy_bundled_realm_files_with_progress(nullptr);
+}
+
 void remove_realm_files_from_directory(const std::string &directory)
 {
     @autoreleasepool {
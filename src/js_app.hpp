@@ -24,10 +24,12 @@
 #include <realm/object-store/sync/app_credentials.hpp>
 
 #include <realm/object-store/util/event_loop_dispatcher.hpp>
+#include <realm/util/file.hpp>
 
 #include "js_user.hpp"
 #include "js_app_credentials.hpp"
 #include "js_network_transport.hpp"
+#include "native_network_transport.hpp"
 #include "js_email_password_auth.hpp"
 
 using SharedApp = std::shared_ptr<realm::app::App>;
@@ -60,9 +62,17 @@ public:
      * Exposed to allow other components (ex the RPCServer) to override the underlying implementation.
      */
     static inline NetworkTransportFactory transport_generator = +[] (ContextType ctx, typename NetworkTransport::Dispatcher eld) -> std::unique_ptr<app::GenericNetworkTransport> {
+        if (prefer_native_transport && native_transport_factory) {
+            return native_transport_factory();
+        }
         return std::make_unique<NetworkTransport>(ctx, std::move(eld));
     };
 
+    // When set and a platform backend is registered (see
+    // native_network_transport.hpp), Apps perform their HTTP traffic through
+    // the native transport instead of dispatching to the JS fetch.
+    static inline bool prefer_native_transport = false;
+
     // These values are overridden at runtime
     static inline std::string package_version = "?.?.?";
     static inline std::string platform_context = "unknown-context";
@@ -98,6 +108,7 @@ public:
     static void clear_app_cache(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void get_app(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void set_versions(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void get_fast_boot_metadata(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     MethodMap<T> const methods = {
         {"_logIn", wrap<log_in>},
@@ -108,8 +119,17 @@ public:
     MethodMap<T> const static_methods = {
         {"_clearAppCache", wrap<clear_app_cache>},
         {"_getApp", wrap<get_app>},
-        {"_setVersions", wrap<set_versions>}
+        {"_setVersions", wrap<set_versions>},
+        {"_fastBootMetadata", wrap<get_fast_boot_metadata>}
     };
+
+private:
+    // Fast-boot snapshot: the essential metadata (current user, tokens, base
+    // URL) mirrored into a small sidecar file, so a cold start can read it
+    // with one mapped read before the App - and with it the metadata realm -
+    // is constructed.
+    static std::string fast_boot_snapshot_path(const std::string& app_id);
+    static void write_fast_boot_snapshot(const SharedApp& app);
 };
 
 template<typename T>
@@ -130,6 +150,7 @@ void AppClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments
     static const String config_app = "app";
     static const String config_app_name = "name";
     static const String config_app_version = "version";
+    static const String config_sync = "sync";
 
     args.validate_count(1);
 
@@ -137,6 +158,7 @@ void AppClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments
 
     std::string id;
     realm::app::App::Config config;
+    SyncClientConfig client_config;
 
     if (Value::is_object(ctx, args[0])) {
         ObjectType config_object = Value::validated_to_object(ctx, args[0]);
@@ -173,6 +195,38 @@ void AppClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments
                 config.local_app_version = util::Optional<std::string>(Value::validated_to_string(ctx, config_app_version_value, "version"));
             }
         }
+
+        // Sync client knobs must be fixed before the first session starts, so
+        // they are part of the app configuration rather than methods on Sync.
+        // With many Realms synced at once, multiplexing all sessions over one
+        // connection avoids per-session connection-establishment convoys.
+        ValueType config_sync_value = Object::get_property(ctx, config_object, config_sync);
+        if (!Value::is_undefined(ctx, config_sync_value)) {
+            ObjectType sync_object = Value::validated_to_object(ctx, config_sync_value, "sync");
+
+            static const String sync_multiplex = "multiplexSessions";
+            ValueType multiplex_value = Object::get_property(ctx, sync_object, sync_multiplex);
+            if (!Value::is_undefined(ctx, multiplex_value)) {
+                client_config.multiplex_sessions = Value::validated_to_boolean(ctx, multiplex_value, "multiplexSessions");
+            }
+
+            static const String sync_timeouts = "timeouts";
+            ValueType timeouts_value = Object::get_property(ctx, sync_object, sync_timeouts);
+            if (!Value::is_undefined(ctx, timeouts_value)) {
+                ObjectType timeouts_object = Value::validated_to_object(ctx, timeouts_value, "timeouts");
+                auto read_timeout = [&](const char* name, uint64_t& field) {
+                    ValueType value = Object::get_property(ctx, timeouts_object, name);
+                    if (!Value::is_undefined(ctx, value)) {
+                        field = uint64_t(Value::validated_to_number(ctx, value, name));
+                    }
+                };
+                read_timeout("connectTimeout", client_config.timeouts.connect_timeout);
+                read_timeout("connectionLingerTime", client_config.timeouts.connection_linger_time);
+                read_timeout("pingKeepalivePeriod", client_config.timeouts.ping_keepalive_period);
+                read_timeout("pongKeepaliveTimeout", client_config.timeouts.pong_keepalive_timeout);
+                read_timeout("fastReconnectLimit", client_config.timeouts.fast_reconnect_limit);
+            }
+        }
     }
     else if (Value::is_string(ctx, args[0])) {
         config.app_id = Value::validated_to_string(ctx, args[0]);
@@ -190,7 +244,6 @@ void AppClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments
     auto realm_file_directory = default_realm_file_directory();
     ensure_directory_exists_for_file(realm_file_directory);
 
-    SyncClientConfig client_config;
     client_config.base_file_path = realm_file_directory;
     client_config.metadata_mode = SyncManager::MetadataMode::NoEncryption;
     client_config.user_agent_binding_info = get_user_agent();
@@ -198,6 +251,94 @@ void AppClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments
     SharedApp app = app::App::get_shared_app(config, client_config);
 
     set_internal<T, AppClass<T>>(ctx, this_object, new SharedApp(app));
+
+    write_fast_boot_snapshot(app);
+}
+
+template<typename T>
+std::string AppClass<T>::fast_boot_snapshot_path(const std::string& app_id)
+{
+    return default_realm_file_directory() + "/" + app_id + ".fastboot";
+}
+
+// Mirrors the current user and tokens into the fast-boot sidecar file. The
+// snapshot is purely an accelerator - it is rewritten whenever the state it
+// reflects changes and losing it only costs the shortcut - so failures to
+// write it are swallowed. Tokens are stored with the same (lack of)
+// protection as the metadata realm, which uses MetadataMode::NoEncryption.
+template<typename T>
+void AppClass<T>::write_fast_boot_snapshot(const SharedApp& app)
+{
+    std::string contents = "1\n";
+    contents += app->config().app_id + '\n';
+    contents += app->config().base_url.value_or("") + '\n';
+    if (auto user = app->current_user()) {
+        contents += user->identity() + '\n';
+        contents += user->access_token() + '\n';
+        contents += user->refresh_token() + '\n';
+    }
+
+    try {
+        util::File file(fast_boot_snapshot_path(app->config().app_id), util::File::mode_Write);
+        file.write(contents.data(), contents.size());
+    }
+    catch (...) {
+    }
+}
+
+template<typename T>
+void AppClass<T>::get_fast_boot_metadata(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_count(1);
+    std::string app_id = Value::validated_to_string(ctx, args[0], "appId");
+
+    return_value.set_null();
+
+    std::string path = fast_boot_snapshot_path(app_id);
+    if (!util::File::exists(path)) {
+        return;
+    }
+
+    std::string contents;
+    try {
+        util::File file(path);
+        size_t size = size_t(file.get_size());
+        if (size == 0) {
+            return;
+        }
+        util::File::Map<char> map(file, util::File::access_ReadOnly, size);
+        contents.assign(map.get_addr(), size);
+    }
+    catch (...) {
+        return;
+    }
+
+    // Line-oriented: version, app id, base URL, then - when a user was logged
+    // in at snapshot time - user id, access token and refresh token.
+    std::vector<std::string> lines;
+    size_t start = 0;
+    while (start < contents.size()) {
+        size_t end = contents.find('\n', start);
+        if (end == std::string::npos) {
+            break;
+        }
+        lines.push_back(contents.substr(start, end - start));
+        start = end + 1;
+    }
+    if (lines.size() < 3 || lines[0] != "1" || lines[1] != app_id) {
+        return;
+    }
+
+    auto metadata = Object::create_obj(ctx, {
+        {"appId", Value::from_string(ctx, lines[1])},
+        {"baseUrl", Value::from_string(ctx, lines[2])},
+    });
+    if (lines.size() >= 6) {
+        Object::set_property(ctx, metadata, "userId", Value::from_string(ctx, lines[3]));
+        Object::set_property(ctx, metadata, "accessToken", Value::from_string(ctx, lines[4]));
+        Object::set_property(ctx, metadata, "refreshToken", Value::from_string(ctx, lines[5]));
+    }
+    return_value.set(metadata);
 }
 
 template<typename T>
@@ -225,6 +366,7 @@ void AppClass<T>::log_in(ContextType ctx, ObjectType this_object, Arguments &arg
     app->log_in_with_credentials(app_credentials, Function::wrap_callback_result_first(ctx, this_object, callback_function,
         [app] (ContextType ctx, SharedUser user) {
             REALM_ASSERT_RELEASE(user);
+            write_fast_boot_snapshot(app);
             return UserClass<T>::create_instance(ctx, std::move(user), std::move(app));
         }));
 
@@ -262,6 +404,7 @@ void AppClass<T>::switch_user(ContextType ctx, ObjectType this_object, Arguments
     auto user = get_internal<T, UserClass<T>>(ctx, Value::validated_to_object(ctx, args[0], "user"));
 
     app->switch_user(*user);
+    write_fast_boot_snapshot(app);
     return_value.set(Value::from_undefined(ctx));
 }
 
@@ -49,7 +49,7 @@ struct CollectionClass : ClassDefinition<T, Collection, ObservableClass<T>> {
     std::string const name = "Collection";
 
     static inline ValueType create_collection_change_set(ContextType ctx, StringData object_type, const ObjectChangeSet &change_set, realm::SharedRealm old_realm, realm::SharedRealm new_realm);
-    static inline ValueType create_collection_change_set(ContextType ctx, const CollectionChangeSet &change_set);
+    static inline ValueType create_collection_change_set(ContextType ctx, const CollectionChangeSet &change_set, bool legacy_change_arrays = false);
 };
 
 template<typename T>
@@ -93,17 +93,33 @@ typename T::Value CollectionClass<T>::create_collection_change_set(ContextType c
 }
 
 template<typename T>
-typename T::Value CollectionClass<T>::create_collection_change_set(ContextType ctx, const CollectionChangeSet &change_set)
+typename T::Value CollectionClass<T>::create_collection_change_set(ContextType ctx, const CollectionChangeSet &change_set, bool legacy_change_arrays)
 {
     ObjectType object = Object::create_empty(ctx);
     std::vector<ValueType> scratch;
-    auto make_array = [&](realm::IndexSet const& index_set) {
-        scratch.clear();
-        scratch.reserve(index_set.count());
+    std::vector<uint32_t> indexes;
+    auto make_array = [&](realm::IndexSet const& index_set) -> ValueType {
+        if (legacy_change_arrays) {
+            scratch.clear();
+            scratch.reserve(index_set.count());
+            for (auto index : index_set.as_indexes()) {
+                scratch.push_back(Value::from_number(ctx, index));
+            }
+            return Object::create_array(ctx, scratch);
+        }
+        // Copy the index set into a Uint32Array backed by a single buffer
+        // allocation; a sync burst over a large table produces thousands of
+        // indexes per set and boxing each one dominates delivery time.
+        indexes.clear();
+        indexes.reserve(index_set.count());
         for (auto index : index_set.as_indexes()) {
-            scratch.push_back(Value::from_number(ctx, index));
+            indexes.push_back(static_cast<uint32_t>(index));
         }
-        return Object::create_array(ctx, scratch);
+        auto constructor = Value::to_function(ctx, Object::get_global(ctx, "Uint32Array"));
+        return Function<T>::construct(ctx, constructor, {
+            Value::from_nonnull_binary(ctx, BinaryData(reinterpret_cast<const char*>(indexes.data()),
+                                                       indexes.size() * sizeof(uint32_t))),
+        });
     };
 
     if (change_set.deletions.count() == std::numeric_limits<size_t>::max()) {
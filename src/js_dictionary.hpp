@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "common/js_plain_object.hpp"
 #include "js_class.hpp"
 #include "js_collection.hpp"
 #include "js_object_accessor.hpp"
@@ -113,7 +114,9 @@ public:
     Dictionary& operator=(Dictionary&&) = default;
     Dictionary& operator=(Dictionary const&) = default;
 
-    std::vector<std::pair<Protected<typename T::Function>, NotificationToken>> m_listeners;
+    std::vector<Protected<typename T::Function>> m_listeners;
+    // One core registration shared by every listener; see add_listener.
+    NotificationToken m_notification_token;
 };
 
 template<typename T>
@@ -138,6 +141,8 @@ struct DictionaryClass : ClassDefinition<T, realm::js::Dictionary<T>, Collection
     static void has(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void keys(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void set(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void put_all(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void get_all(ContextType, ObjectType, Arguments &, ReturnValue &);
     // observables
     static void add_listener(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void remove_listener(ContextType, ObjectType, Arguments &, ReturnValue &);
@@ -156,6 +161,8 @@ struct DictionaryClass : ClassDefinition<T, realm::js::Dictionary<T>, Collection
         {"_has", wrap<has>},
         {"_keys", wrap<keys>},
         {"set", wrap<set>},
+        {"putAll", wrap<put_all>},
+        {"getAll", wrap<get_all>},
         {"addListener", wrap<add_listener>},
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
@@ -230,6 +237,59 @@ void DictionaryClass<T>::set(ContextType ctx, ObjectType this_object, Arguments
     return_value.set(this_object);
 }
 
+template<typename T>
+void DictionaryClass<T>::put_all(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    auto dictionary = get_internal<T, DictionaryClass<T>>(ctx, this_object);
+    auto values = Value::validated_to_object(ctx, args[0], "values");
+    auto names = Object::get_property_names(ctx, values);
+
+    // Enumerate and validate everything up front, then write all entries
+    // through a single accessor, instead of one setter dispatch per key.
+    std::vector<ValueType> elements;
+    elements.reserve(names.size());
+    for (auto& name : names) {
+        elements.push_back(Object::get_property(ctx, values, name));
+        validate_value(ctx, *dictionary, elements.back());
+    }
+
+    NativeAccessor<T> accessor(ctx, *dictionary);
+    for (size_t i = 0; i < names.size(); i++) {
+        dictionary->insert(accessor, std::string(names[i]), elements[i]);
+    }
+
+    return_value.set(this_object);
+}
+
+template<typename T>
+void DictionaryClass<T>::get_all(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(1);
+
+    auto dictionary = get_internal<T, DictionaryClass<T>>(ctx, this_object);
+    auto result = Object::create_empty(ctx);
+    NativeAccessor<T> accessor(ctx, *dictionary);
+
+    if (args.count == 0) {
+        for (auto&& [k, v] : *dictionary) {
+            std::string key = k.get_string();
+            Object::set_property(ctx, result, key, dictionary->get(accessor, key));
+        }
+    }
+    else {
+        auto keys_as_array = Value::validated_to_array(ctx, args[0], "keys");
+        uint32_t length = Object::validated_get_length(ctx, keys_as_array);
+        for (uint32_t i = 0; i < length; i++) {
+            std::string key = Value::validated_to_string(ctx, Object::get_property(ctx, keys_as_array, i));
+            if (dictionary->contains(key)) {
+                Object::set_property(ctx, result, key, dictionary->get(accessor, key));
+            }
+        }
+    }
+
+    return_value.set(result);
+}
+
 template<typename T>
 void DictionaryClass<T>::remove(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(1);
@@ -284,7 +344,6 @@ void DictionaryClass<T>::keys(ContextType ctx, ObjectType this_object, Arguments
 
 template<typename T>
 typename T::Value DictionaryClass<T>::create_dictionary_change_set(ContextType ctx, DictionaryChangeSet const& change_set) {
-    ObjectType object = Object::create_empty(ctx);
     std::vector<ValueType> scratch;
 
     scratch.reserve(std::max({change_set.deletions.size(), change_set.insertions.size(), change_set.modifications.size()}));
@@ -296,10 +355,13 @@ typename T::Value DictionaryClass<T>::create_dictionary_change_set(ContextType c
         return Object::create_array(ctx, scratch);
     };
 
-    return Object::create_obj(ctx, {
-        {"deletions", make_object_array(change_set.deletions)},
-        {"insertions", make_object_array(change_set.insertions)},
-        {"modifications", make_object_array(change_set.modifications)},
+    // The payload has the same three keys for every notification; the shape
+    // interns them once instead of re-creating the key strings per change set.
+    static PlainObjectShape<T> shape({"deletions", "insertions", "modifications"});
+    return shape.stamp(ctx, {
+        make_object_array(change_set.deletions),
+        make_object_array(change_set.insertions),
+        make_object_array(change_set.modifications),
     });
 }
 
@@ -310,19 +372,30 @@ void DictionaryClass<T>::add_listener(ContextType ctx, ObjectType this_object, A
     args.validate_maximum(1);
     auto callback = Value::validated_to_function(ctx, args[0]);
     Protected<FunctionType> protected_callback(ctx, callback);
-    Protected<ObjectType> protected_this(ctx, this_object);
-    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
-    auto token = dictionary->add_key_based_notification_callback([=](DictionaryChangeSet const& change_set, std::exception_ptr exception) {
-        HANDLESCOPE(protected_ctx)
-
-        ValueType arguments[] {
-            DictionaryClass<T>::create_instance(protected_ctx, *dictionary),
-            DictionaryClass<T>::create_dictionary_change_set(protected_ctx, change_set)
-        };
 
-        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
-    });
-    dictionary->m_listeners.emplace_back(protected_callback, std::move(token));
+    // One core registration per dictionary, shared by every listener: the
+    // instance and the change-set payload are built once per changeset and
+    // fanned out to all callbacks inside a single handle scope, instead of
+    // entering the VM once per listener.
+    if (dictionary->m_listeners.empty()) {
+        Protected<ObjectType> protected_this(ctx, this_object);
+        Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+        dictionary->m_notification_token = dictionary->add_key_based_notification_callback([=](DictionaryChangeSet const& change_set, std::exception_ptr exception) {
+            HANDLESCOPE(protected_ctx)
+
+            ValueType arguments[] {
+                DictionaryClass<T>::create_instance(protected_ctx, *dictionary),
+                DictionaryClass<T>::create_dictionary_change_set(protected_ctx, change_set)
+            };
+
+            // Iterate a copy; a callback may add or remove listeners.
+            auto listeners = dictionary->m_listeners;
+            for (auto& listener : listeners) {
+                Function<T>::callback(protected_ctx, listener, protected_this, 2, arguments);
+            }
+        });
+    }
+    dictionary->m_listeners.emplace_back(std::move(protected_callback));
 }
 
 template<typename T>
@@ -334,10 +407,13 @@ void DictionaryClass<T>::remove_listener(ContextType ctx, ObjectType this_object
     auto protected_function = Protected<FunctionType>(ctx, callback); // Protecting for comparison, not to extend lifetime.
 
     auto& listeners = dictionary->m_listeners;
-    auto compare = [&](auto&& func_and_tok) {
-        return typename Protected<FunctionType>::Comparator()(func_and_tok.first, protected_function);
+    auto compare = [&](auto&& func) {
+        return typename Protected<FunctionType>::Comparator()(func, protected_function);
     };
     listeners.erase(std::remove_if(listeners.begin(), listeners.end(), compare), listeners.end());
+    if (listeners.empty()) {
+        dictionary->m_notification_token = {};
+    }
 }
 
 
@@ -347,6 +423,7 @@ void DictionaryClass<T>::remove_all_listeners(ContextType ctx, ObjectType this_o
 
     args.validate_maximum(0);
     dictionary->m_listeners.clear();
+    dictionary->m_notification_token = {};
 }
 
 } // js
@@ -40,6 +40,16 @@ class List : public realm::List {
     List(const realm::List &l) : realm::List(l) {}
 
     std::vector<std::pair<Protected<typename T::Function>, NotificationToken>> m_notification_tokens;
+
+    // Cached size() stamped with the read-transaction version it was computed
+    // under; see ListClass::get_length.
+    util::Optional<size_t> m_cached_size;
+    VersionID m_cached_size_version;
+
+    // Mutable because create_filtered only sees the collection by const reference.
+    mutable FilteredQueryCache m_filtered_query_cache;
+
+    SortDescriptorCache m_sort_descriptor_cache;
 };
 
 template<typename T>
@@ -65,13 +75,19 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
 
     // methods
     static void push(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void extend(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void pop(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void unshift(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void shift(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void splice(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void slice(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void to_typed_array(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void to_json(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void snapshot(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void filtered(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void sorted(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void freeze(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void get_is_frozen(ContextType, ObjectType, ReturnValue &);
     static void is_valid(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void is_empty(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void index_of(ContextType, ObjectType, Arguments &, ReturnValue &);
@@ -85,16 +101,21 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
 
     MethodMap<T> const methods = {
         {"push", wrap<push>},
+        {"extend", wrap<extend>},
         {"pop", wrap<pop>},
         {"unshift", wrap<unshift>},
         {"shift", wrap<shift>},
         {"splice", wrap<splice>},
+        {"slice", wrap<slice>},
+        {"toTypedArray", wrap<to_typed_array>},
+        {"_toJSON", wrap<to_json>},
         {"snapshot", wrap<snapshot>},
         {"filtered", wrap<filtered>},
         {"sorted", wrap<sorted>},
         {"isValid", wrap<is_valid>},
         {"isEmpty", wrap<is_empty>},
         {"indexOf", wrap<index_of>},
+        {"freeze", wrap<freeze>},
         {"min", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Min>>},
         {"max", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Max>>},
         {"sum", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Sum>>},
@@ -108,6 +129,7 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
         {"length", {wrap<get_length>, nullptr}},
         {"type", {wrap<get_type>, nullptr}},
         {"optional", {wrap<get_optional>, nullptr}},
+        {"isFrozen", {wrap<get_is_frozen>, nullptr}},
     };
 
     IndexPropertyType<T> const index_accessor = {wrap<get_index>, wrap<set_index>};
@@ -124,7 +146,19 @@ typename T::Object ListClass<T>::create_instance(ContextType ctx, realm::List li
 template<typename T>
 void ListClass<T>::get_length(ContextType ctx, ObjectType object, ReturnValue &return_value) {
     auto list = get_internal<T, ListClass<T>>(ctx, object);
-    return_value.set(static_cast<uint32_t>(list->size()));
+    auto realm = list->get_realm();
+    // Inside a write transaction the size can change without the version
+    // advancing, so only serve the cache from a plain read transaction.
+    if (!realm || realm->is_in_transaction()) {
+        return_value.set(static_cast<uint32_t>(list->size()));
+        return;
+    }
+    auto version = realm->read_transaction_version();
+    if (!list->m_cached_size || list->m_cached_size_version != version) {
+        list->m_cached_size = list->size();
+        list->m_cached_size_version = version;
+    }
+    return_value.set(static_cast<uint32_t>(*list->m_cached_size));
 }
 
 template<typename T>
@@ -170,6 +204,33 @@ void ListClass<T>::push(ContextType ctx, ObjectType this_object, Arguments &args
     return_value.set((uint32_t)list->size());
 }
 
+template<typename T>
+void ListClass<T>::extend(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+    auto values = Value::validated_to_array(ctx, args[0], "values");
+    uint32_t size = Object::validated_get_length(ctx, values);
+
+    // Read the elements out and validate them before the first write, so a
+    // type error cannot leave the list partially extended. Unlike push() this
+    // takes a single array argument, avoiding engine limits on argument counts
+    // and the per-element varargs marshalling for large ingests.
+    std::vector<ValueType> elements;
+    elements.reserve(size);
+    for (uint32_t i = 0; i < size; i++) {
+        elements.push_back(Object::get_property(ctx, values, i));
+        validate_value(ctx, *list, elements.back());
+    }
+
+    NativeAccessor<T> accessor(ctx, *list);
+    for (auto& element : elements) {
+        list->add(accessor, element);
+    }
+
+    return_value.set((uint32_t)list->size());
+}
+
 template<typename T>
 void ListClass<T>::pop(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(0);
@@ -234,26 +295,127 @@ void ListClass<T>::splice(ContextType ctx, ObjectType this_object, Arguments &ar
         remove = std::min<long>(remove, size - index);
     }
 
+    size_t insert_count = args.count > 2 ? args.count - 2 : 0;
+
     std::vector<ValueType> removed_objects;
     removed_objects.reserve(remove);
 
     NativeAccessor<T> accessor(ctx, *list);
+    // Read the removed window out before mutating, then overwrite the
+    // overlapping region in place. This shifts the tail only for the size
+    // difference between removals and insertions rather than once per element.
     for (size_t i = 0; i < remove; i++) {
-        removed_objects.push_back(list->get(accessor, index));
-        list->remove(index);
+        removed_objects.push_back(list->get(accessor, index + i));
+    }
+
+    size_t overlap = std::min(remove, insert_count);
+    for (size_t i = 0; i < overlap; i++) {
+        list->set(accessor, index + i, args[2 + i]);
     }
-    for (size_t i = 2; i < args.count; i++) {
-        list->insert(accessor, index + i - 2, args[i]);
+    for (size_t i = overlap; i < remove; i++) {
+        list->remove(index + overlap);
+    }
+    for (size_t i = overlap; i < insert_count; i++) {
+        list->insert(accessor, index + i, args[2 + i]);
     }
 
     return_value.set(Object::create_array(ctx, removed_objects));
 }
 
+template<typename T>
+void ListClass<T>::slice(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+    return_value.set(ResultsClass<T>::create_slice(ctx, *list, args));
+}
+
+template<typename T>
+void ListClass<T>::to_typed_array(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+
+    auto type = list->get_type();
+    if (is_nullable(type)) {
+        throw std::runtime_error("toTypedArray() is not supported on optional lists");
+    }
+
+    // Stage the column natively and hand it to the engine as a single buffer,
+    // so a 100k-element list costs one boundary crossing instead of one per
+    // element.
+    size_t size = list->size();
+    const char* constructor_name;
+    std::vector<char> bytes;
+    switch (type & ~realm::PropertyType::Flags) {
+        case realm::PropertyType::Int: {
+            // JS numbers are doubles, so int lists export as Float64Array to
+            // keep the values identical to element-wise reads.
+            constructor_name = "Float64Array";
+            bytes.resize(size * sizeof(double));
+            auto out = reinterpret_cast<double*>(bytes.data());
+            for (size_t i = 0; i < size; i++) {
+                out[i] = static_cast<double>(list->template get<int64_t>(i));
+            }
+            break;
+        }
+        case realm::PropertyType::Float: {
+            constructor_name = "Float32Array";
+            bytes.resize(size * sizeof(float));
+            auto out = reinterpret_cast<float*>(bytes.data());
+            for (size_t i = 0; i < size; i++) {
+                out[i] = list->template get<float>(i);
+            }
+            break;
+        }
+        case realm::PropertyType::Double: {
+            constructor_name = "Float64Array";
+            bytes.resize(size * sizeof(double));
+            auto out = reinterpret_cast<double*>(bytes.data());
+            for (size_t i = 0; i < size; i++) {
+                out[i] = list->template get<double>(i);
+            }
+            break;
+        }
+        case realm::PropertyType::Date: {
+            // Dates export as epoch milliseconds — the same value element-wise
+            // reads pass to the Date constructor — so timestamp-heavy columns
+            // can skip boxing a Date object per element.
+            constructor_name = "Float64Array";
+            bytes.resize(size * sizeof(double));
+            auto out = reinterpret_cast<double*>(bytes.data());
+            for (size_t i = 0; i < size; i++) {
+                auto ts = list->template get<realm::Timestamp>(i);
+                out[i] = static_cast<double>(ts.get_seconds() * 1000 + ts.get_nanoseconds() / 1000000);
+            }
+            break;
+        }
+        default:
+            throw std::runtime_error("toTypedArray() is only supported on int, float, double and date lists");
+    }
+
+    auto constructor = Value::to_function(ctx, Object::get_global(ctx, constructor_name));
+    return_value.set(Function<T>::construct(ctx, constructor, {
+        Value::from_nonnull_binary(ctx, BinaryData(bytes.data(), bytes.size())),
+    }));
+}
+
+template<typename T>
+void ListClass<T>::to_json(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+    return_value.set(ResultsClass<T>::create_json(ctx, *list, args));
+}
+
 template<typename T>
 void ListClass<T>::snapshot(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(0);
     auto list = get_internal<T, ListClass<T>>(ctx, this_object);
-    return_value.set(ResultsClass<T>::create_instance(ctx, list->snapshot()));
+    auto realm = list->get_realm();
+    // Inside a write transaction mutations are not signalled ahead of time,
+    // so the copy-on-write machinery cannot defer the pin; materialize
+    // eagerly as before.
+    if (realm && realm->is_in_transaction()) {
+        return_value.set(ResultsClass<T>::create_instance(ctx, list->snapshot()));
+        return;
+    }
+    return_value.set(ResultsClass<T>::create_lazy_snapshot(ctx, *list));
 }
 
 template<typename T>
@@ -265,7 +427,23 @@ void ListClass<T>::filtered(ContextType ctx, ObjectType this_object, Arguments &
 template<typename T>
 void ListClass<T>::sorted(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     auto list = get_internal<T, ListClass<T>>(ctx, this_object);
-    return_value.set(ResultsClass<T>::create_instance(ctx, list->sort(ResultsClass<T>::get_keypaths(ctx, args))));
+    return_value.set(ResultsClass<T>::create_sorted(ctx, *list, args));
+}
+
+template<typename T>
+void ListClass<T>::freeze(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+    // Freezing pins the current version; the frozen wrapper never advances,
+    // never notifies, and may be read from any thread.
+    auto frozen_realm = list->get_realm()->freeze();
+    return_value.set(create_instance(ctx, list->freeze(frozen_realm)));
+}
+
+template<typename T>
+void ListClass<T>::get_is_frozen(ContextType ctx, ObjectType this_object, ReturnValue &return_value) {
+    return_value.set(get_internal<T, ListClass<T>>(ctx, this_object)->is_frozen());
 }
 
 template<typename T>
@@ -34,6 +34,10 @@ public:
     }
 
     ResponseHandlerCompletionCallback m_completion_callback;
+    // Body accumulated chunk by chunk when the transport streams it through
+    // onBodyChunk; peak memory on the JS side stays at one chunk instead of
+    // the whole payload.
+    std::string m_streamed_body;
 };
 
 template<typename T>
@@ -58,10 +62,12 @@ public:
 
     static void on_success(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void on_error(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void on_body_chunk(ContextType, ObjectType, Arguments &, ReturnValue &);
 
     MethodMap<T> const methods = {
         {"onSuccess", wrap<on_success>},
         {"onError", wrap<on_error>},
+        {"onBodyChunk", wrap<on_body_chunk>},
     };
 };
 
@@ -113,7 +119,28 @@ void ResponseHandlerClass<T>::on_success(ContextType ctx, ObjectType this_object
     if (!Value::is_undefined(ctx, body_value)) {
         body = Value::validated_to_string(ctx, body_value);
     }
-    response_handler->m_completion_callback(app::Response{http_status_code, custom_status_code, headers, body});
+    else {
+        // The transport streamed the body through onBodyChunk instead of
+        // buffering it into one JS string.
+        body = std::move(response_handler->m_streamed_body);
+    }
+    response_handler->m_completion_callback(app::Response{http_status_code, custom_status_code, std::move(headers), std::move(body)});
+}
+
+// Appends one body chunk, delivered either as binary (raw UTF-8 bytes, which
+// sidesteps decoding chunk boundaries that split a code point) or as a string.
+template<typename T>
+void ResponseHandlerClass<T>::on_body_chunk(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value) {
+    args.validate_count(1);
+
+    auto response_handler = get_internal<T, ResponseHandlerClass<T>>(ctx, this_object);
+    if (Value::is_binary(ctx, args[0])) {
+        auto data = Value::validated_to_binary(ctx, args[0]);
+        response_handler->m_streamed_body.append(data.data(), data.size());
+    }
+    else {
+        response_handler->m_streamed_body += Value::validated_to_string(ctx, args[0]);
+    }
 }
 
 
@@ -187,7 +214,7 @@ struct JavaScriptNetworkTransport : public app::GenericNetworkTransport {
 
     JavaScriptNetworkTransport(ContextType ctx, Dispatcher eld) : m_ctx(ctx), m_dispatcher(std::move(eld)) {};
 
-    static ObjectType makeRequest(ContextType ctx, const app::Request& request) {
+    static ObjectType makeRequest(ContextType ctx, app::Request&& request) {
         ObjectType headers_object = Object::create_empty(ctx);
         for (auto header : request.headers) {
             Object::set_property(ctx, headers_object, header.first, Value::from_string(ctx, header.second));
@@ -199,7 +226,16 @@ struct JavaScriptNetworkTransport : public app::GenericNetworkTransport {
             {"headers", headers_object}
         });
         if (!request.body.empty()) {
-            Object::set_property(ctx, request_object, "body", Value::from_string(ctx, request.body));
+            // Large payloads (e.g. sync bootstrap uploads) move across the
+            // boundary as an externally-backed ArrayBuffer instead of being
+            // re-encoded into a JS string; fetch() accepts either body type.
+            constexpr size_t external_body_threshold = 64 * 1024;
+            if (request.body.size() >= external_body_threshold) {
+                Object::set_property(ctx, request_object, "body", Value::from_external_binary(ctx, std::move(request.body)));
+            }
+            else {
+                Object::set_property(ctx, request_object, "body", Value::from_string(ctx, request.body));
+            }
         }
         return request_object;
     }
@@ -215,7 +251,7 @@ struct JavaScriptNetworkTransport : public app::GenericNetworkTransport {
                 ValueType network_transport = Object::get_property(ctx, realm_constructor, "_networkTransport");
 
                 Object::call_method(ctx, Value::to_object(ctx, network_transport), "fetchWithCallbacks", {
-                    makeRequest(ctx, request),
+                    makeRequest(ctx, std::move(request)),
                     ResponseHandlerClass<T>::create_instance(ctx, std::move(completion_callback)),
                 });
             });
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <map>
+#include <string_view>
+
 #include <realm/keys.hpp>
 
 #include "js_list.hpp"
@@ -43,6 +46,34 @@ template<typename JSEngine, typename T>
 struct Unbox;
 }
 
+// Bump allocator for per-value conversion buffers. Blocks grow geometrically
+// and nothing is freed until the arena goes away, which bounds malloc traffic
+// during bulk imports: an accessor's temporaries all die with it at the end
+// of the write anyway, so individual deallocation is wasted work.
+class ScratchArena {
+  public:
+    char* allocate(size_t size) {
+        if (m_used + size > m_capacity) {
+            grow(size);
+        }
+        char* data = m_blocks.back().get() + m_used;
+        m_used += size;
+        return data;
+    }
+
+  private:
+    void grow(size_t size) {
+        m_capacity = std::max(m_capacity * 2, std::max(size, s_initial_block_size));
+        m_blocks.push_back(std::make_unique<char[]>(m_capacity));
+        m_used = 0;
+    }
+
+    static constexpr size_t s_initial_block_size = 4096;
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    size_t m_used = 0;
+    size_t m_capacity = 0;
+};
+
 template<typename JSEngine>
 class NativeAccessor {
 public:
@@ -95,13 +126,32 @@ public:
 
     ~NativeAccessor() { }
 
-    OptionalValue value_for_property(ValueType dict, Property const& prop, size_t) {
+    OptionalValue value_for_property(ValueType dict, Property const& prop, size_t prop_index) {
         ObjectType object = Value::validated_to_object(m_ctx, dict);
-        ValueType value = Object::get_property(m_ctx, object, !prop.public_name.empty() ? prop.public_name : prop.name);
+
+        // Look the property up through the schema's interned key when
+        // available, so bulk creates reuse one JS string per property
+        // instead of re-encoding the name for every object.
+        ValueType value;
+        auto delegate = m_object_schema ? get_delegate<JSEngine>(m_realm.get()) : nullptr;
+        bool schema_indexed = delegate && prop_index < m_object_schema->persisted_properties.size()
+                && &m_object_schema->persisted_properties[prop_index] == &prop;
+        if (schema_indexed) {
+            auto& keys = delegate->property_keys(*m_object_schema);
+            value = Object::get_property(m_ctx, object, static_cast<ValueType>(keys[prop_index]));
+        }
+        else {
+            value = Object::get_property(m_ctx, object, !prop.public_name.empty() ? prop.public_name : prop.name);
+        }
         if (Value::is_undefined(m_ctx, value)) {
             return util::none;
         }
-        if (!Value::is_valid_for_property(m_ctx, value, prop)) {
+        // The per-schema validator table resolves the property's type switch
+        // once instead of per value.
+        bool valid = schema_indexed
+            ? delegate->property_validators(*m_object_schema)[prop_index](m_ctx, value, prop)
+            : Value::is_valid_for_property(m_ctx, value, prop);
+        if (!valid) {
             throw TypeErrorException(*this, m_object_schema->name, prop, value);
         }
         return value;
@@ -132,10 +182,31 @@ public:
     template<typename T>
     ValueType box(util::Optional<T> v) { return v ? box(*v) : null_value(); }
     ValueType box(bool boolean)      { return Value::from_boolean(m_ctx, boolean); }
-    ValueType box(int64_t number)    { return Value::from_number(m_ctx, number); }
+    ValueType box(int64_t number)    { return Value::from_integer(m_ctx, number); }
     ValueType box(float number)      { return Value::from_number(m_ctx, number); }
     ValueType box(double number)     { return Value::from_number(m_ctx, number); }
-    ValueType box(StringData string) { return Value::from_string(m_ctx, string.data()); }
+    ValueType box(StringData string) {
+        // Low-cardinality columns (status/type/region style enums) repeat the
+        // same short values across millions of rows, so short strings are
+        // boxed once per accessor and the protected handle reused instead of
+        // re-encoding a fresh JS string per row. The cache is bounded, so
+        // high-cardinality columns fall back to plain allocation once full.
+        constexpr size_t max_interned_size = 32;
+        constexpr size_t max_interned_values = 64;
+        if (string.size() <= max_interned_size && !string.is_null()) {
+            std::string_view key(string.data(), string.size());
+            auto it = m_interned_strings.find(key);
+            if (it != m_interned_strings.end()) {
+                return it->second;
+            }
+            ValueType value = Value::from_string(m_ctx, string.data());
+            if (m_interned_strings.size() < max_interned_values) {
+                m_interned_strings.emplace(std::string(key), Protected<ValueType>(m_ctx, value));
+            }
+            return value;
+        }
+        return Value::from_string(m_ctx, string.data());
+    }
     ValueType box(BinaryData data)   { return Value::from_binary(m_ctx, data); }
     ValueType box(ObjectId objectId) { return Value::from_object_id(m_ctx, objectId); }
     ValueType box(Decimal128 number) { return Value::from_decimal128(m_ctx, number); }
@@ -269,6 +340,13 @@ private:
     const ObjectSchema* m_object_schema;
     std::string m_string_buffer;
     OwnedBinaryData m_owned_binary_data;
+    ScratchArena m_scratch;
+    // Last type unboxed into a Mixed; batches of Mixed values tend to run on
+    // one type, so to_mixed() probes this converter first.
+    DataType::Type m_last_mixed_type = DataType::Type::Mixed;
+    // Interned JS handles for short repeated string values (see box(StringData)).
+    // std::less<> keys the lookup on a string_view, so cache hits don't allocate.
+    std::map<std::string, Protected<ValueType>, std::less<>> m_interned_strings;
     template<typename, typename>
     friend struct _impl::Unbox;
 };
@@ -284,6 +362,11 @@ struct Unbox<JSEngine, bool> {
 template<typename JSEngine>
 struct Unbox<JSEngine, int64_t> {
     static int64_t call(NativeAccessor<JSEngine> *ctx, typename JSEngine::Value const& value, realm::CreatePolicy, ObjKey) {
+        // Numbers take the engine's integer path; anything else goes through
+        // the validated conversion for the usual TypeError.
+        if (js::Value<JSEngine>::is_number(ctx->m_ctx, value)) {
+            return js::Value<JSEngine>::to_integer(ctx->m_ctx, value);
+        }
         return js::Value<JSEngine>::validated_to_number(ctx->m_ctx, value, "Property");
     }
 };
@@ -377,16 +460,27 @@ struct Unbox<JSEngine, BinaryData> {
             // the incoming value might be a base64 string, so let's try to parse it
             std::string str = js::Value<JSEngine>::to_string(ctx->m_ctx, value);
             size_t max_size = util::base64_decoded_size(str.size());
-            std::unique_ptr<char[]> data(new char[max_size]);
-            if (auto size = util::base64_decode(str, data.get(), max_size)) {
-                ctx->m_owned_binary_data = OwnedBinaryData(std::move(data), *size);
-                return ctx->m_owned_binary_data.get();
+            // The decoded blob only needs to survive until core copies it
+            // into the column, so it comes from the accessor's arena rather
+            // than its own heap allocation.
+            char* data = ctx->m_scratch.allocate(max_size);
+            if (auto size = util::base64_decode(str, data, max_size)) {
+                return BinaryData(data, *size);
             } else {
                 throw std::runtime_error("Attempting to populate BinaryData from string that is not valid base64");
             }
         }
 #endif
 
+        // Core copies the blob into the column synchronously, so when the
+        // engine can hand out a direct pointer to the buffer's storage we
+        // pass a non-owning view instead of staging an intermediate copy.
+        if (js::Value<JSEngine>::is_binary(ctx->m_ctx, value)) {
+            BinaryData view = js::Value<JSEngine>::to_binary_view(ctx->m_ctx, value);
+            if (view) {
+                return view;
+            }
+        }
         ctx->m_owned_binary_data = js::Value<JSEngine>::validated_to_binary(ctx->m_ctx, value);
         return ctx->m_owned_binary_data.get();
     }
@@ -395,7 +489,7 @@ struct Unbox<JSEngine, BinaryData> {
 template<typename JSEngine>
 struct Unbox<JSEngine, Mixed> {
     static Mixed call(NativeAccessor<JSEngine> *ctx, typename JSEngine::Value const& value, realm::CreatePolicy, ObjKey) {
-        return js::Value<JSEngine>::to_mixed(ctx->m_ctx, ctx->m_realm, value, ctx->m_string_buffer); // no need to validate type for a mixed value
+        return js::Value<JSEngine>::to_mixed(ctx->m_ctx, ctx->m_realm, value, ctx->m_string_buffer, ctx->m_last_mixed_type); // no need to validate type for a mixed value
     }
 };
 
@@ -28,7 +28,12 @@
 #include "js_results.hpp"
 #include "js_schema.hpp"
 #include "js_observable.hpp"
+#include "common/object/observer.hpp"
+#include "metrics.hpp"
 #include "platform.hpp"
+#include "tracing.hpp"
+#include "worker_scheduler.hpp"
+#include "writer_queue.hpp"
 
 #if REALM_ENABLE_SYNC
 #include "js_sync.hpp"
@@ -46,6 +51,7 @@
 
 #include <realm/object-store/binding_context.hpp>
 #include <realm/object-store/object_accessor.hpp>
+#include <realm/object-store/util/event_loop_dispatcher.hpp>
 #include <realm/object-store/results.hpp>
 #include <realm/object-store/shared_realm.hpp>
 #include <realm/object-store/thread_safe_reference.hpp>
@@ -57,11 +63,21 @@
 #include <realm/util/scope_exit.hpp>
 #include <realm/sync/config.hpp>
 
+#include <algorithm>
 #include <cctype>
+#include <deque>
+#include <limits>
 #include <list>
+#include <thread>
 #include <map>
 #include <any>
 
+#if !defined(WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
 namespace realm {
 namespace js {
 
@@ -79,6 +95,61 @@ static std::string normalize_realm_path(std::string path) {
     return path;
 }
 
+// Warms the OS page cache for a freshly opened Realm file on a background
+// thread, so the first queries after a cold start don't page-fault the
+// mapping in on demand. `mode` is "sequential" or "willneed"; a positive
+// `size_hint` limits both the advisory and the eager read to that many bytes.
+static void prefetch_realm_file(std::string path, std::string mode, int64_t size_hint) {
+#if defined(WIN32) && WIN32
+    // No fadvise equivalent worth the complexity here; the eager read below
+    // would also warm the cache, but Windows deployments are not the cold
+    // mobile storage this targets.
+    static_cast<void>(path);
+    static_cast<void>(mode);
+    static_cast<void>(size_hint);
+#else
+    std::thread([path = std::move(path), mode = std::move(mode), size_hint] {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            ::close(fd);
+            return;
+        }
+        auto length = uint64_t(info.st_size);
+        if (size_hint > 0 && uint64_t(size_hint) < length) {
+            length = uint64_t(size_hint);
+        }
+
+#if defined(__APPLE__)
+        // No posix_fadvise on Darwin; F_RDADVISE is the closest hint.
+        struct radvisory advice{0, int(std::min<uint64_t>(length, uint64_t(std::numeric_limits<int>::max())))};
+        fcntl(fd, F_RDADVISE, &advice);
+#elif defined(POSIX_FADV_WILLNEED)
+        posix_fadvise(fd, 0, off_t(length), mode == "sequential" ? POSIX_FADV_SEQUENTIAL : POSIX_FADV_WILLNEED);
+#endif
+
+        // Touch the front of the file regardless of mode: the top-level group
+        // and allocator metadata live there and are the pages every first
+        // query needs.
+        constexpr uint64_t max_eager_read = 4 * 1024 * 1024;
+        uint64_t to_read = std::min(length, max_eager_read);
+        char buf[BUFSIZ];
+        uint64_t done = 0;
+        while (done < to_read) {
+            ssize_t nb_read = ::read(fd, buf, size_t(std::min(uint64_t(sizeof(buf)), to_read - done)));
+            if (nb_read <= 0) {
+                break;
+            }
+            done += uint64_t(nb_read);
+        }
+        ::close(fd);
+    }).detach();
+#endif
+}
+
 template<typename T> class RealmClass;
 template<typename T> class AsyncOpenTaskClass;
 
@@ -86,17 +157,38 @@ template<typename T>
 class RealmDelegate : public BindingContext {
 private:
     void did_change(std::vector<ObserverState> const&, std::vector<void*> const&, bool) override {
+        m_notification_batch.reset();
+        // Rows may have been created or deleted in the new version.
+        m_primary_key_cache.clear();
+        if (m_notifications_paused) {
+            // Remember that versions advanced; resume delivers one coalesced
+            // "change" event instead of a storm per bulk-import transaction.
+            m_change_suppressed = true;
+            return;
+        }
         HANDLESCOPE(m_context)
         notify(m_notifications, "change");
     }
 
     void schema_did_change(realm::Schema const& schema) override {
+        m_property_keys.clear();
+        m_property_validators.clear();
+        m_primary_key_cache.clear();
+        m_schema_cache = util::none;
         HANDLESCOPE(m_context)
         ObjectType schema_object = Schema<T>::object_for_schema(m_context, schema);
         notify(m_schema_notifications, "schema", schema_object);
     }
 
     void before_notify() override {
+        // Pending copy-on-write snapshots must pin before the read version
+        // moves; see ResultsClass::create_lazy_snapshot.
+        if (auto realm = m_realm.lock()) {
+            SnapshotPinRegistry::pin_all(realm.get());
+        }
+        // Coalesce subscriber deliveries produced while the version advances;
+        // did_change() closes the batch and flushes them in one VM entry.
+        m_notification_batch = std::make_unique<NotificationBatcher::BatchGuard>();
         HANDLESCOPE(m_context)
         notify(m_before_notify_notifications, "beforenotify");
     }
@@ -127,6 +219,9 @@ public:
         m_notifications.clear();
         m_schema_notifications.clear();
         m_before_notify_notifications.clear();
+        m_property_keys.clear();
+        m_pending_writes.clear();
+        m_schema_cache = util::none;
     }
 
     void add_notification(FunctionType notification) {
@@ -171,6 +266,215 @@ public:
     ObjectDefaultsMap m_defaults;
     ConstructorMap m_constructors;
 
+    // Weak identity map of JS object wrappers keyed by (table key, object
+    // key). Boxing the same row repeatedly returns the cached wrapper, which
+    // makes JS `===` hold across accesses and avoids re-allocating a wrapper
+    // plus engine reference per read. Entries do not keep wrappers alive;
+    // dead ones are dropped on lookup and swept periodically on insert.
+    util::Optional<ObjectType> get_cached_object(TableKey table_key, ObjKey obj_key) {
+        auto it = m_object_wrappers.find({table_key.value, obj_key.value});
+        if (it == m_object_wrappers.end()) {
+            return util::none;
+        }
+        if (!it->second) {
+            m_object_wrappers.erase(it);
+            return util::none;
+        }
+        return it->second.get();
+    }
+
+    // Interned JS strings for the persisted properties of a schema, indexed
+    // by property position. Built on first use and reused for every object
+    // created or read with that schema, so bulk operations stop re-encoding
+    // UTF-8 property names per object. Invalidated on schema changes.
+    std::vector<Protected<ValueType>>& property_keys(const realm::ObjectSchema& schema) {
+        auto& keys = m_property_keys[schema.name];
+        if (keys.size() != schema.persisted_properties.size()) {
+            keys.clear();
+            keys.reserve(schema.persisted_properties.size());
+            for (auto& prop : schema.persisted_properties) {
+                auto& name = !prop.public_name.empty() ? prop.public_name : prop.name;
+                keys.emplace_back(m_context, Value::from_string(m_context, name));
+            }
+        }
+        return keys;
+    }
+
+    // Companion table to property_keys: the validation function pointer for
+    // each persisted property, resolved once per schema so per-object writes
+    // skip the type switch in is_valid_for_property.
+    std::vector<typename Value::PropertyValidator>& property_validators(const realm::ObjectSchema& schema) {
+        auto& validators = m_property_validators[schema.name];
+        if (validators.size() != schema.persisted_properties.size()) {
+            validators.clear();
+            validators.reserve(schema.persisted_properties.size());
+            for (auto& prop : schema.persisted_properties) {
+                validators.push_back(Value::validator_for_property(prop));
+            }
+        }
+        return validators;
+    }
+
+    // Queues a writeAsync() callback. Core requires a Realm to stay on the
+    // thread it was opened on, so the write itself still runs on the JS
+    // thread — but it is deferred through the event loop, letting the
+    // caller's stack return before the transaction (and its fsync) happens.
+    // The queue preserves submission order across calls.
+    void enqueue_async_write(FunctionType callback, FunctionType completion) {
+        m_pending_writes.push_back({Protected<FunctionType>(m_context, callback),
+                                    Protected<FunctionType>(m_context, completion)});
+        if (!m_write_dispatcher) {
+            std::weak_ptr<realm::Realm> weak_realm = m_realm;
+            m_write_dispatcher = std::make_shared<util::EventLoopDispatcher<void()>>([weak_realm] {
+                if (auto realm = weak_realm.lock(); realm && !realm->is_closed()) {
+                    get_delegate<T>(realm.get())->drain_pending_writes(realm);
+                }
+            });
+        }
+        (*m_write_dispatcher)();
+    }
+
+    // Cached JS representation of realm.schema. Building the deep object
+    // graph costs hundreds of allocations for schema-heavy apps, so it is
+    // materialized once and handed back until the schema changes. Callers
+    // therefore see the same (mutable) object across accesses.
+    util::Optional<ValueType> cached_schema_object() {
+        if (m_schema_cache) {
+            return static_cast<ValueType>(*m_schema_cache);
+        }
+        return util::none;
+    }
+
+    void cache_schema_object(ValueType schema_object) {
+        m_schema_cache = Protected<ValueType>(m_context, schema_object);
+    }
+
+    // Primary-key lookup cache: (table key, encoded primary key) → object
+    // key. Only consulted and populated outside write transactions, and the
+    // whole map drops whenever the read version advances, so the worst a hit
+    // can do is name a row deleted in the current version — which the caller
+    // re-checks against the table before trusting it.
+    util::Optional<ObjKey> get_cached_primary_key(TableKey table_key, const std::string& pk) {
+        auto it = m_primary_key_cache.find({table_key.value, pk});
+        if (it == m_primary_key_cache.end()) {
+            return util::none;
+        }
+        return ObjKey(it->second);
+    }
+
+    void cache_primary_key(TableKey table_key, const std::string& pk, ObjKey obj_key) {
+        m_primary_key_cache[{table_key.value, pk}] = obj_key.value;
+    }
+
+    void forget_cached_primary_key(TableKey table_key, const std::string& pk) {
+        m_primary_key_cache.erase({table_key.value, pk});
+    }
+
+    void cache_object(TableKey table_key, ObjKey obj_key, ObjectType object) {
+        if (++m_wrapper_inserts % 256 == 0) {
+            for (auto it = m_object_wrappers.begin(); it != m_object_wrappers.end();) {
+                it = it->second ? std::next(it) : m_object_wrappers.erase(it);
+            }
+        }
+        m_object_wrappers[{table_key.value, obj_key.value}] = WeakObjectReference<ObjectType>(m_context, object);
+    }
+
+    // Opt-in via the `batchedWrites` config flag: queued writeAsync() work
+    // that has accumulated by drain time commits as one core transaction.
+    void set_batched_writes(bool batched) {
+        m_batched_writes = batched;
+    }
+
+    // Gates JS delivery of Realm-level "change" events without tearing down
+    // the registrations, so import jobs no longer need to remove and rebuild
+    // all listeners around a bulk write. Events suppressed while paused
+    // coalesce into a single delivery on resume.
+    void set_notifications_paused(bool paused) {
+        if (m_notifications_paused && !paused) {
+            m_notifications_paused = false;
+            if (m_change_suppressed) {
+                m_change_suppressed = false;
+                HANDLESCOPE(m_context)
+                notify(m_notifications, "change");
+            }
+            return;
+        }
+        m_notifications_paused = paused;
+    }
+
+    bool notifications_paused() const {
+        return m_notifications_paused;
+    }
+
+    // Runs queued writeAsync() work in submission order. In the default mode
+    // each entry gets its own transaction so a throwing callback doesn't
+    // poison the writes queued after it; the completion callback receives
+    // (result, error). In batched mode the whole queue shares one
+    // begin/commit cycle, falling back to per-write transactions if any
+    // callback in the group throws.
+    void drain_pending_writes(const SharedRealm& realm) {
+        HANDLESCOPE(m_context)
+        while (!m_pending_writes.empty()) {
+            if (realm->is_in_transaction()) {
+                // A synchronous transaction is open (e.g. an enclosing
+                // write()); retry once the event loop turns again.
+                (*m_write_dispatcher)();
+                return;
+            }
+
+            if (!m_batched_writes || m_pending_writes.size() == 1) {
+                auto pending = std::move(m_pending_writes.front());
+                m_pending_writes.pop_front();
+                run_queued_write(realm, pending);
+                continue;
+            }
+
+            // Everything queued since the last drain — the writes that
+            // arrived within one event-loop turn — becomes a single group
+            // commit, paying one begin/commit cycle and one durability sync.
+            std::vector<PendingWrite> batch;
+            batch.reserve(m_pending_writes.size());
+            while (!m_pending_writes.empty()) {
+                batch.push_back(std::move(m_pending_writes.front()));
+                m_pending_writes.pop_front();
+            }
+
+            std::vector<ValueType> results;
+            results.reserve(batch.size());
+            SnapshotPinRegistry::pin_all(realm.get());
+            realm->begin_transaction();
+            bool failed = false;
+            try {
+                for (auto& pending : batch) {
+                    results.push_back(Function<T>::call(m_context, pending.callback, 0, nullptr));
+                }
+                realm->commit_transaction();
+            }
+            catch (const std::exception&) {
+                failed = true;
+                if (realm->is_in_transaction()) {
+                    realm->cancel_transaction();
+                }
+            }
+
+            if (!failed) {
+                for (size_t i = 0; i < batch.size(); i++) {
+                    ValueType callback_arguments[2] = {results[i], Value::from_undefined(m_context)};
+                    Function<T>::callback(m_context, batch[i].completion, 2, callback_arguments);
+                }
+                continue;
+            }
+
+            // A callback threw, rolling back the whole group. Replay the
+            // batch one transaction per write so only the failing entries
+            // reject; callbacks earlier in the group run a second time since
+            // their changes were cancelled along with the rest.
+            for (auto& pending : batch) {
+                run_queued_write(realm, pending);
+            }
+        }
+    }
+
   private:
     Protected<GlobalContextType> m_context;
     std::list<Protected<FunctionType>> m_notifications;
@@ -178,6 +482,45 @@ public:
     std::list<Protected<FunctionType>> m_before_notify_notifications;
     std::weak_ptr<realm::Realm> m_realm;
     std::string m_realm_path;
+    std::unique_ptr<NotificationBatcher::BatchGuard> m_notification_batch;
+    std::map<std::pair<uint32_t, int64_t>, WeakObjectReference<ObjectType>> m_object_wrappers;
+    size_t m_wrapper_inserts = 0;
+    std::map<std::string, std::vector<Protected<ValueType>>> m_property_keys;
+    std::map<std::string, std::vector<typename Value::PropertyValidator>> m_property_validators;
+
+    struct PendingWrite {
+        Protected<FunctionType> callback;
+        Protected<FunctionType> completion;
+    };
+    std::deque<PendingWrite> m_pending_writes;
+    std::shared_ptr<util::EventLoopDispatcher<void()>> m_write_dispatcher;
+    bool m_batched_writes = false;
+    bool m_notifications_paused = false;
+    bool m_change_suppressed = false;
+    std::map<std::pair<uint32_t, std::string>, int64_t> m_primary_key_cache;
+    util::Optional<Protected<ValueType>> m_schema_cache;
+
+    void run_queued_write(const SharedRealm& realm, PendingWrite& pending) {
+        ValueType result = Value::from_undefined(m_context);
+        ValueType error = Value::from_undefined(m_context);
+        SnapshotPinRegistry::pin_all(realm.get());
+        realm->begin_transaction();
+        try {
+            result = Function<T>::call(m_context, pending.callback, 0, nullptr);
+            realm->commit_transaction();
+        }
+        catch (const std::exception& e) {
+            if (realm->is_in_transaction()) {
+                realm->cancel_transaction();
+            }
+            ObjectType object = js::Object<T>::create_empty(m_context);
+            js::Object<T>::set_property(m_context, object, "message", Value::from_string(m_context, e.what()));
+            error = object;
+        }
+
+        ValueType callback_arguments[2] = {result, error};
+        Function<T>::callback(m_context, pending.completion, 2, callback_arguments);
+    }
 
     void add(std::list<Protected<FunctionType>>& notifications, FunctionType fn) {
         if (std::find(notifications.begin(), notifications.end(), fn) != notifications.end()) {
@@ -297,10 +640,14 @@ public:
     // methods
     static void objects(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void object_for_primary_key(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void objects_for_primary_keys(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void create(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void create_all(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void delete_one(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void delete_all(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void delete_all_async(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void write(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void write_async(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void begin_transaction(ContextType, ObjectType, Arguments &, ReturnValue&);
     static void commit_transaction(ContextType, ObjectType, Arguments &, ReturnValue&);
     static void cancel_transaction(ContextType, ObjectType, Arguments &, ReturnValue&);
@@ -310,11 +657,18 @@ public:
     static void remove_all_listeners(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void close(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void compact(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void compact_async(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void writeCopyTo(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void writeCopyToAsync(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void delete_model(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void object_for_object_id(ContextType, ObjectType, Arguments &, ReturnValue&);
     static void get_schema_name_from_object(ContextType, ObjectType, Arguments &, ReturnValue&);
     static void update_schema(ContextType, ObjectType, Arguments &, ReturnValue&);
+    static void update_schema_incremental(ContextType, ObjectType, Arguments &, ReturnValue&);
+    static void memory_usage(ContextType, ObjectType, Arguments &, ReturnValue&);
+    static void import_handover(ContextType, ObjectType, Arguments &, ReturnValue&);
+    static void enqueue_write(ContextType, ObjectType, Arguments &, ReturnValue&);
+    static void freeze(ContextType, ObjectType, Arguments &, ReturnValue&);
 
 #if REALM_ENABLE_SYNC
     static void async_open_realm(ContextType, ObjectType, Arguments &, ReturnValue&);
@@ -329,6 +683,9 @@ public:
     static void get_read_only(ContextType, ObjectType, ReturnValue &);
     static void get_is_in_transaction(ContextType, ObjectType, ReturnValue &);
     static void get_is_closed(ContextType, ObjectType, ReturnValue &);
+    static void get_is_frozen(ContextType, ObjectType, ReturnValue &);
+    static void get_notifications_paused(ContextType, ObjectType, ReturnValue &);
+    static void set_notifications_paused(ContextType, ObjectType, ValueType);
 #if REALM_ENABLE_SYNC
     static void get_sync_session(ContextType, ObjectType, ReturnValue &);
 #endif
@@ -342,11 +699,18 @@ public:
     static void schema_version(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void clear_test_state(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void copy_bundled_realm_files(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void copy_bundled_realm_files_async(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void delete_file(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void realm_file_exists(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void get_cached_instance(ContextType, ObjectType, Arguments &, ReturnValue &);
 
     static void bson_parse_json(ContextType, ObjectType, Arguments &, ReturnValue &);
 
+    static void get_metrics(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void set_metrics_enabled(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void start_trace(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void stop_trace(ContextType, ObjectType, Arguments &, ReturnValue &);
+
     // static properties
     static void get_default_path(ContextType, ObjectType, ReturnValue &);
     static void set_default_path(ContextType, ObjectType, ValueType value);
@@ -357,9 +721,15 @@ public:
         {"schemaVersion", wrap<schema_version>},
         {"clearTestState", wrap<clear_test_state>},
         {"copyBundledRealmFiles", wrap<copy_bundled_realm_files>},
+        {"_copyBundledRealmFilesAsync", wrap<copy_bundled_realm_files_async>},
         {"deleteFile", wrap<delete_file>},
         {"exists", wrap<realm_file_exists>},
+        {"getCachedInstance", wrap<get_cached_instance>},
         {"_bsonParseJsonForTest", wrap<bson_parse_json>},
+        {"_metrics", wrap<get_metrics>},
+        {"_setMetricsEnabled", wrap<set_metrics_enabled>},
+        {"_startTrace", wrap<start_trace>},
+        {"_stopTrace", wrap<stop_trace>},
 #if REALM_ENABLE_SYNC
         {"_asyncOpen", wrap<async_open_realm>},
 #endif
@@ -372,10 +742,14 @@ public:
     MethodMap<T> const methods = {
         {"objects", wrap<objects>},
         {"objectForPrimaryKey", wrap<object_for_primary_key>},
+        {"objectsForPrimaryKeys", wrap<objects_for_primary_keys>},
         {"create", wrap<create>},
+        {"createAll", wrap<create_all>},
         {"delete", wrap<delete_one>},
         {"deleteAll", wrap<delete_all>},
+        {"_deleteAllAsync", wrap<delete_all_async>},
         {"write", wrap<write>},
+        {"_writeAsync", wrap<write_async>},
         {"beginTransaction", wrap<begin_transaction>},
         {"commitTransaction", wrap<commit_transaction>},
         {"cancelTransaction", wrap<cancel_transaction>},
@@ -384,10 +758,17 @@ public:
         {"removeAllListeners", wrap<remove_all_listeners>},
         {"close", wrap<close>},
         {"compact", wrap<compact>},
+        {"_compactAsync", wrap<compact_async>},
         {"writeCopyTo", wrap<writeCopyTo>},
+        {"_writeCopyToAsync", wrap<writeCopyToAsync>},
         {"deleteModel", wrap<delete_model>},
         {"_updateSchema", wrap<update_schema>},
+        {"_updateSchemaIncremental", wrap<update_schema_incremental>},
         {"_schemaName", wrap<get_schema_name_from_object>},
+        {"_memoryUsage", wrap<memory_usage>},
+        {"_import", wrap<import_handover>},
+        {"_enqueueWrite", wrap<enqueue_write>},
+        {"freeze", wrap<freeze>},
     };
 
     PropertyMap<T> const properties = {
@@ -399,6 +780,8 @@ public:
         {"readOnly", {wrap<get_read_only>, nullptr}},
         {"isInTransaction", {wrap<get_is_in_transaction>, nullptr}},
         {"isClosed", {wrap<get_is_closed>, nullptr}},
+        {"isFrozen", {wrap<get_is_frozen>, nullptr}},
+        {"notificationsPaused", {wrap<get_notifications_paused>, wrap<set_notifications_paused>}},
 #if REALM_ENABLE_SYNC
         {"syncSession", {wrap<get_sync_session>, nullptr}},
 #endif
@@ -447,6 +830,66 @@ public:
         return *object_schema;
     }
 
+    // Encodes a JS primary-key value for the delegate's lookup cache, tagged
+    // by type so int/string/ObjectId/UUID keys can't collide. Returns none
+    // for values that don't match the property type, leaving validation and
+    // error reporting to the regular lookup path.
+    static util::Optional<std::string> primary_key_cache_string(ContextType ctx, const Property& pk_prop, const ValueType& value) {
+        if (Value::is_null(ctx, value) || Value::is_undefined(ctx, value)) {
+            return util::none;
+        }
+        switch (pk_prop.type & ~realm::PropertyType::Flags) {
+            case realm::PropertyType::Int:
+                if (Value::is_number(ctx, value)) {
+                    return util::format("i:%1", static_cast<int64_t>(Value::to_number(ctx, value)));
+                }
+                break;
+            case realm::PropertyType::String:
+                if (Value::is_string(ctx, value)) {
+                    return std::string("s:") + std::string(Value::to_string(ctx, value));
+                }
+                break;
+            case realm::PropertyType::ObjectId:
+                if (Value::is_object_id(ctx, value)) {
+                    return std::string("o:") + Value::to_object_id(ctx, value).to_string();
+                }
+                break;
+            case realm::PropertyType::UUID:
+                if (Value::is_uuid(ctx, value)) {
+                    return std::string("u:") + Value::to_uuid(ctx, value).to_string();
+                }
+                break;
+            default:
+                break;
+        }
+        return util::none;
+    }
+
+    static realm::CreatePolicy validated_create_policy(ContextType ctx, const ValueType &value) {
+        if (Value::is_boolean(ctx, value)) {
+            // Deprecated API
+            if (Value::validated_to_boolean(ctx, value)) {
+                return realm::CreatePolicy::UpdateAll;
+            }
+            return realm::CreatePolicy::ForceCreate;
+        }
+        else if (Value::is_string(ctx, value)) {
+            // New API accepting an updateMode parameter
+            std::string mode = Value::validated_to_string(ctx, value);
+            if (mode == "never") {
+                return realm::CreatePolicy::ForceCreate;
+            }
+            else if (mode == "modified") {
+                return realm::CreatePolicy::UpdateModified;
+            }
+            else if (mode == "all") {
+                return realm::CreatePolicy::UpdateAll;
+            }
+            throw std::runtime_error("Unsupported 'updateMode'. Only 'never', 'modified' or 'all' is supported.");
+        }
+        throw std::runtime_error("Unsupported 'updateMode'. Only the strings 'never', 'modified' or 'all' is supported.");
+    }
+
     static realm::Realm::Config validate_and_normalize_config(ContextType ctx, ValueType value) {
         if (!Value::is_object(ctx, value)) {
             throw std::runtime_error("Invalid argument, expected a Realm configuration object");
@@ -497,31 +940,35 @@ inline typename T::Function RealmClass<T>::create_constructor(ContextType ctx) {
     Object::set_property(ctx, realm_constructor, "Object", realm_object_constructor, attributes);
 
 #if REALM_ENABLE_SYNC
-    FunctionType app_constructor = AppClass<T>::create_constructor(ctx);
-    Object::set_property(ctx, realm_constructor, "App", app_constructor, attributes);
-
-    FunctionType credentials_constructor = CredentialsClass<T>::create_constructor(ctx);
-    Object::set_property(ctx, realm_constructor, "Credentials", credentials_constructor, attributes);
-
-    FunctionType user_constructor = UserClass<T>::create_constructor(ctx);
-    Object::set_property(ctx, realm_constructor, "User", user_constructor, attributes);
-
-    FunctionType response_handler_constructor = ResponseHandlerClass<T>::create_constructor(ctx);
-    Object::set_property(ctx, realm_constructor, "ResponseHandler", response_handler_constructor, attributes);
-
-    FunctionType auth_constructor = AuthClass<T>::create_constructor(ctx);
-    Object::set_property(ctx, realm_constructor, "Auth", auth_constructor, attributes);
+    // The sync-related classes are exposed through lazy accessors so local-only
+    // apps don't pay for their class initialization at module load. Instances
+    // created before the accessor is ever read still work because
+    // ObjectWrap::create_instance initializes the class on demand.
+    Object::set_lazy_property(ctx, realm_constructor, "App", [](ContextType ctx) -> ValueType {
+        FunctionType app_constructor = AppClass<T>::create_constructor(ctx);
+        Object::set_property(ctx, app_constructor, "Sync", SyncClass<T>::create_constructor(ctx), ReadOnly | DontEnum | DontDelete);
+        return app_constructor;
+    });
 
-    FunctionType email_password_provider_client_constructor = EmailPasswordAuthClass<T>::create_constructor(ctx);
-    Object::set_property(ctx, auth_constructor, "EmailPasswordAuth", email_password_provider_client_constructor, attributes);
+    Object::set_lazy_property(ctx, realm_constructor, "Credentials", [](ContextType ctx) -> ValueType {
+        return CredentialsClass<T>::create_constructor(ctx);
+    });
 
-    FunctionType user_apikey_provider_client_constructor = ApiKeyAuthClass<T>::create_constructor(ctx);
-    Object::set_property(ctx, auth_constructor, "ApiKeyAuth", user_apikey_provider_client_constructor, attributes);
+    Object::set_lazy_property(ctx, realm_constructor, "User", [](ContextType ctx) -> ValueType {
+        return UserClass<T>::create_constructor(ctx);
+    });
 
-    FunctionType sync_constructor = SyncClass<T>::create_constructor(ctx);
-    Object::set_property(ctx, app_constructor, "Sync", sync_constructor, attributes);
+    Object::set_lazy_property(ctx, realm_constructor, "ResponseHandler", [](ContextType ctx) -> ValueType {
+        return ResponseHandlerClass<T>::create_constructor(ctx);
+    });
 
-    AsyncOpenTaskClass<T>::create_constructor(ctx);
+    Object::set_lazy_property(ctx, realm_constructor, "Auth", [](ContextType ctx) -> ValueType {
+        FunctionType auth_constructor = AuthClass<T>::create_constructor(ctx);
+        PropertyAttributes attributes = ReadOnly | DontEnum | DontDelete;
+        Object::set_property(ctx, auth_constructor, "EmailPasswordAuth", EmailPasswordAuthClass<T>::create_constructor(ctx), attributes);
+        Object::set_property(ctx, auth_constructor, "ApiKeyAuth", ApiKeyAuthClass<T>::create_constructor(ctx), attributes);
+        return auth_constructor;
+    });
 #endif
 
     if (getenv("REALM_DISABLE_SYNC_TO_DISK")) {
@@ -608,7 +1055,7 @@ bool RealmClass<T>::get_realm_config(ContextType ctx, size_t argc, const ValueTy
             ValueType schema_value = Object::get_property(ctx, object, schema_string);
             if (!Value::is_undefined(ctx, schema_value)) {
                 ObjectType schema_array = Value::validated_to_array(ctx, schema_value, "schema");
-                config.schema.emplace(Schema<T>::parse_schema(ctx, schema_array, defaults, constructors));
+                config.schema.emplace(Schema<T>::parse_schema_cached(ctx, schema_array, defaults, constructors));
                 schema_updated = true;
             }
 
@@ -628,9 +1075,44 @@ bool RealmClass<T>::get_realm_config(ContextType ctx, size_t argc, const ValueTy
                     throw std::invalid_argument("Cannot set 'shouldCompactOnLaunch' when 'readOnly' is set.");
                 }
 
-                FunctionType should_compact_on_launch_function = Value::validated_to_function(ctx, compact_value, "shouldCompactOnLaunch");
-                ShouldCompactOnLaunchFunctor<T> should_compact_on_launch_functor {ctx, should_compact_on_launch_function};
-                config.should_compact_on_launch_function = std::move(should_compact_on_launch_functor);
+                if (Value::is_function(ctx, compact_value)) {
+                    FunctionType should_compact_on_launch_function = Value::validated_to_function(ctx, compact_value, "shouldCompactOnLaunch");
+                    ShouldCompactOnLaunchFunctor<T> should_compact_on_launch_functor {ctx, should_compact_on_launch_function};
+                    config.should_compact_on_launch_function = std::move(should_compact_on_launch_functor);
+                }
+                else {
+                    // Declarative policy: evaluated natively on the opening
+                    // thread, so the open does not block on a round trip to
+                    // the JS event loop like the callback form does.
+                    ObjectType policy_object = Value::validated_to_object(ctx, compact_value, "shouldCompactOnLaunch");
+
+                    static const String max_file_size_string = "maxFileSizeBytes";
+                    static const String min_free_ratio_string = "minFreeSpaceRatio";
+                    util::Optional<uint64_t> max_file_size;
+                    util::Optional<double> min_free_ratio;
+                    ValueType max_value = Object::get_property(ctx, policy_object, max_file_size_string);
+                    if (!Value::is_undefined(ctx, max_value)) {
+                        max_file_size = uint64_t(Value::validated_to_number(ctx, max_value, "maxFileSizeBytes"));
+                    }
+                    ValueType ratio_value = Object::get_property(ctx, policy_object, min_free_ratio_string);
+                    if (!Value::is_undefined(ctx, ratio_value)) {
+                        min_free_ratio = Value::validated_to_number(ctx, ratio_value, "minFreeSpaceRatio");
+                    }
+                    if (!max_file_size && !min_free_ratio) {
+                        throw std::invalid_argument("A 'shouldCompactOnLaunch' policy must set 'maxFileSizeBytes' and/or 'minFreeSpaceRatio'.");
+                    }
+
+                    config.should_compact_on_launch_function = [max_file_size, min_free_ratio](uint64_t total_bytes, uint64_t used_bytes) {
+                        if (max_file_size && total_bytes <= *max_file_size) {
+                            return false;
+                        }
+                        if (min_free_ratio && total_bytes > 0
+                                && double(total_bytes - used_bytes) / double(total_bytes) < *min_free_ratio) {
+                            return false;
+                        }
+                        return true;
+                    };
+                }
             }
 
             static const String migration_string = "migration";
@@ -704,9 +1186,100 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, Argumen
     bool schema_updated = get_realm_config(ctx, args.count, args.value, config, defaults, constructors);
     auto realm = create_shared_realm(ctx, config, schema_updated, std::move(defaults), std::move(constructors));
 
+    // `batchedWrites` only affects how the binding schedules writeAsync()
+    // transactions, so it lives on the delegate rather than core's config.
+    if (args.count >= 1 && Value::is_object(ctx, args.value[0])) {
+        ObjectType config_object = Value::validated_to_object(ctx, args.value[0]);
+        static const String batched_writes_string = "batchedWrites";
+        ValueType batched_writes_value = Object::get_property(ctx, config_object, batched_writes_string);
+        if (!Value::is_undefined(ctx, batched_writes_value)) {
+            get_delegate<T>(realm.get())->set_batched_writes(Value::validated_to_boolean(ctx, batched_writes_value, "batchedWrites"));
+        }
+
+        // `prefetch` only warms the page cache, so it runs after the open
+        // rather than being part of core's config.
+        static const String prefetch_string = "prefetch";
+        ValueType prefetch_value = Object::get_property(ctx, config_object, prefetch_string);
+        if (!Value::is_undefined(ctx, prefetch_value)) {
+            if (Value::is_number(ctx, prefetch_value)) {
+                prefetch_realm_file(realm->config().path, "willneed", int64_t(Value::to_number(ctx, prefetch_value)));
+            }
+            else {
+                std::string mode = Value::validated_to_string(ctx, prefetch_value, "prefetch");
+                if (mode != "sequential" && mode != "willneed") {
+                    throw std::invalid_argument("'prefetch' must be 'sequential', 'willneed' or a byte count.");
+                }
+                prefetch_realm_file(realm->config().path, std::move(mode), 0);
+            }
+        }
+    }
+
     set_internal<T, RealmClass<T>>(ctx, this_object, new SharedRealm(realm));
 }
 
+// Per-thread cache of fully constructed Realm instances. Repeated
+// getCachedInstance(config) calls for a path this thread already has open
+// resolve with a hash lookup instead of re-running config parsing and
+// coordinator setup, which is what per-request server handlers acquiring the
+// same Realm hundreds of times per second actually pay for. A cheap scalar
+// fingerprint (schemaVersion/readOnly/inMemory) guards against handing back
+// an instance opened with a different configuration for the same path.
+template<typename T>
+void RealmClass<T>::get_cached_instance(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue &return_value) {
+    args.validate_maximum(1);
+
+    struct CachedEntry {
+        std::string fingerprint;
+        std::weak_ptr<realm::Realm> realm;
+        Protected<ObjectType> object;
+    };
+    static thread_local std::map<std::string, CachedEntry> s_cache;
+
+    std::string path;
+    std::string fingerprint;
+    if (args.count == 1 && Value::is_object(ctx, args[0])) {
+        ObjectType config_object = Value::validated_to_object(ctx, args[0]);
+        path = validate_and_normalize_config(ctx, args[0]).path;
+
+        ValueType schema_version_value = Object::get_property(ctx, config_object, "schemaVersion");
+        if (Value::is_number(ctx, schema_version_value)) {
+            fingerprint += std::to_string(int64_t(Value::to_number(ctx, schema_version_value)));
+        }
+        fingerprint += '|';
+        ValueType read_only_value = Object::get_property(ctx, config_object, "readOnly");
+        fingerprint += Value::to_boolean(ctx, read_only_value) ? '1' : '0';
+        ValueType in_memory_value = Object::get_property(ctx, config_object, "inMemory");
+        fingerprint += Value::to_boolean(ctx, in_memory_value) ? '1' : '0';
+    }
+    else if (args.count == 1 && !Value::is_undefined(ctx, args[0])) {
+        path = normalize_realm_path(Value::validated_to_string(ctx, args[0], "path"));
+    }
+    else {
+        path = normalize_realm_path(js::default_path());
+    }
+
+    auto it = s_cache.find(path);
+    if (it != s_cache.end() && it->second.fingerprint == fingerprint) {
+        if (auto cached = it->second.realm.lock(); cached && !cached->is_closed()) {
+            return_value.set(static_cast<ObjectType>(it->second.object));
+            return;
+        }
+    }
+
+    realm::Realm::Config config;
+    ObjectDefaultsMap defaults;
+    ConstructorMap constructors;
+    bool schema_updated = get_realm_config(ctx, args.count, args.value, config, defaults, constructors);
+    auto realm = create_shared_realm(ctx, config, schema_updated, std::move(defaults), std::move(constructors));
+
+    ObjectType realm_object = create_object<T, RealmClass<T>>(ctx, new SharedRealm(realm));
+    if (it != s_cache.end()) {
+        s_cache.erase(it);
+    }
+    s_cache.insert({path, CachedEntry{std::move(fingerprint), realm, Protected<ObjectType>(ctx, realm_object)}});
+    return_value.set(realm_object);
+}
+
 template<typename T>
 SharedRealm RealmClass<T>::create_shared_realm(ContextType ctx, realm::Realm::Config config, bool schema_updated,
                                                ObjectDefaultsMap&& defaults, ConstructorMap&& constructors) {
@@ -774,6 +1347,65 @@ void RealmClass<T>::copy_bundled_realm_files(ContextType ctx, ObjectType this_ob
     realm::copy_bundled_realm_files();
 }
 
+template<typename T>
+void RealmClass<T>::copy_bundled_realm_files_async(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(2);
+    validate_argument_count_at_least(args.count, 1, "copyBundledRealmFilesAsync requires a completion callback");
+
+    // (completion) or (progress, completion)
+    auto completion = Value::validated_to_function(ctx, args[args.count - 1], "callback");
+    Protected<FunctionType> protected_completion(ctx, completion);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    CopyProgressHandler progress;
+    if (args.count == 2) {
+        auto progress_callback = Value::validated_to_function(ctx, args[0], "progress");
+        Protected<FunctionType> protected_progress(ctx, progress_callback);
+        util::EventLoopDispatcher<void(uint64_t, uint64_t)> progress_dispatcher(
+                [=](uint64_t copied, uint64_t total) {
+            HANDLESCOPE(protected_ctx)
+            ValueType callback_arguments[2] = {
+                Value::from_number(protected_ctx, static_cast<double>(copied)),
+                Value::from_number(protected_ctx, static_cast<double>(total)),
+            };
+            Function<T>::callback(protected_ctx, protected_progress, protected_this, 2, callback_arguments);
+        });
+        progress = [progress_dispatcher = std::move(progress_dispatcher)](uint64_t copied, uint64_t total) {
+            progress_dispatcher(copied, total);
+        };
+    }
+
+    util::EventLoopDispatcher<void(std::exception_ptr)> completion_dispatcher([=](std::exception_ptr error) {
+        HANDLESCOPE(protected_ctx)
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            }
+            catch (const std::exception& e) {
+                ObjectType object = Object::create_empty(protected_ctx);
+                Object::set_property(protected_ctx, object, "message", Value::from_string(protected_ctx, e.what()));
+
+                ValueType callback_arguments[1] = {object};
+                Function<T>::callback(protected_ctx, protected_completion, protected_this, 1, callback_arguments);
+                return;
+            }
+        }
+        ValueType callback_arguments[1] = {Value::from_undefined(protected_ctx)};
+        Function<T>::callback(protected_ctx, protected_completion, protected_this, 1, callback_arguments);
+    });
+
+    std::thread([progress = std::move(progress), completion = std::move(completion_dispatcher)]() mutable {
+        try {
+            realm::copy_bundled_realm_files_with_progress(progress);
+            completion(nullptr);
+        }
+        catch (...) {
+            completion(std::current_exception());
+        }
+    }).detach();
+}
+
 template<typename T>
 void RealmClass<T>::delete_file(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(1);
@@ -855,8 +1487,19 @@ void RealmClass<T>::get_schema_version(ContextType ctx, ObjectType object, Retur
 
 template<typename T>
 void RealmClass<T>::get_schema(ContextType ctx, ObjectType object, ReturnValue &return_value) {
-    auto& schema = get_internal<T, RealmClass<T>>(ctx, object)->get()->schema();
-    ObjectType schema_object = Schema<T>::object_for_schema(ctx, schema);
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, object);
+    auto delegate = get_delegate<T>(realm.get());
+    if (delegate) {
+        if (auto cached = delegate->cached_schema_object()) {
+            return_value.set(*cached);
+            return;
+        }
+    }
+
+    ObjectType schema_object = Schema<T>::object_for_schema(ctx, realm->schema());
+    if (delegate) {
+        delegate->cache_schema_object(schema_object);
+    }
     return_value.set(schema_object);
 }
 
@@ -880,6 +1523,37 @@ void RealmClass<T>::get_is_closed(ContextType ctx, ObjectType object, ReturnValu
     return_value.set(get_internal<T, RealmClass<T>>(ctx, object)->get()->is_closed());
 }
 
+template<typename T>
+void RealmClass<T>::get_is_frozen(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    return_value.set(get_internal<T, RealmClass<T>>(ctx, object)->get()->is_frozen());
+}
+
+template<typename T>
+void RealmClass<T>::get_notifications_paused(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    SharedRealm& realm = *get_internal<T, RealmClass<T>>(ctx, object);
+    auto delegate = get_delegate<T>(realm.get());
+    return_value.set(delegate && delegate->notifications_paused());
+}
+
+template<typename T>
+void RealmClass<T>::set_notifications_paused(ContextType ctx, ObjectType object, ValueType value) {
+    SharedRealm& realm = *get_internal<T, RealmClass<T>>(ctx, object);
+    if (auto delegate = get_delegate<T>(realm.get())) {
+        delegate->set_notifications_paused(Value::validated_to_boolean(ctx, value, "notificationsPaused"));
+    }
+}
+
+template<typename T>
+void RealmClass<T>::freeze(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    // A frozen Realm is pinned to the current version and immutable, so the
+    // wrapper is safe to read from any thread; no delegate is attached since
+    // it can never change or notify.
+    return_value.set(create_object<T, RealmClass<T>>(ctx, new SharedRealm(realm->freeze())));
+}
+
 #if REALM_ENABLE_SYNC
 template<typename T>
 void RealmClass<T>::get_sync_session(ContextType ctx, ObjectType object, ReturnValue &return_value) {
@@ -989,12 +1663,39 @@ void RealmClass<T>::object_for_primary_key(ContextType ctx, ObjectType this_obje
     args.validate_maximum(2);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
-    std::string object_type;
     auto &object_schema = validated_object_schema_for_value(ctx, realm, args[0]);
+
+    // Hot lookups resolve through the delegate's primary-key cache and then
+    // the wrapper identity map in create_instance, skipping both the
+    // accessor setup and core's search index. The cache is bypassed inside
+    // write transactions, where rows come and go without notifications.
+    auto delegate = get_delegate<T>(realm.get());
+    util::Optional<std::string> cache_key;
+    if (delegate && !realm->is_in_transaction()) {
+        if (auto pk_prop = object_schema.primary_key_property()) {
+            cache_key = primary_key_cache_string(ctx, *pk_prop, args[1]);
+        }
+    }
+
+    TableRef table;
+    if (cache_key) {
+        table = ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+        if (auto obj_key = delegate->get_cached_primary_key(table->get_key(), *cache_key)) {
+            if (table->is_valid(*obj_key)) {
+                return_value.set(RealmObjectClass<T>::create_instance(ctx, realm::Object(realm, object_schema, table->get_object(*obj_key))));
+                return;
+            }
+            delegate->forget_cached_primary_key(table->get_key(), *cache_key);
+        }
+    }
+
     NativeAccessor accessor(ctx, realm, object_schema);
     auto realm_object = realm::Object::get_for_primary_key(accessor, realm, object_schema, args[1]);
 
     if (realm_object.is_valid()) {
+        if (cache_key) {
+            delegate->cache_primary_key(table->get_key(), *cache_key, realm_object.obj().get_key());
+        }
         return_value.set(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
     }
     else {
@@ -1002,38 +1703,44 @@ void RealmClass<T>::object_for_primary_key(ContextType ctx, ObjectType this_obje
     }
 }
 
+// Batch form of objectForPrimaryKey for changeset reconciliation: all keys
+// resolve in one native pass over a shared accessor instead of a JS->native
+// crossing per key. The result array is aligned to the input, with null at
+// every position whose key has no match.
+template<typename T>
+void RealmClass<T>::objects_for_primary_keys(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    auto &object_schema = validated_object_schema_for_value(ctx, realm, args[0]);
+    if (!object_schema.primary_key_property()) {
+        throw std::runtime_error(util::format("'%1' does not have a primary key defined", object_schema.name));
+    }
+
+    ObjectType keys = Value::validated_to_array(ctx, args[1], "keys");
+    uint32_t size = Object::validated_get_length(ctx, keys);
+
+    NativeAccessor accessor(ctx, realm, object_schema);
+    std::vector<ValueType> resolved;
+    resolved.reserve(size);
+    for (uint32_t i = 0; i < size; i++) {
+        auto realm_object = realm::Object::get_for_primary_key(accessor, realm, object_schema, Object::get_property(ctx, keys, i));
+        if (realm_object.is_valid()) {
+            resolved.push_back(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
+        }
+        else {
+            resolved.push_back(Value::from_null(ctx));
+        }
+    }
+    return_value.set(Object::create_array(ctx, resolved));
+}
+
 template<typename T>
 void RealmClass<T>::create(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(3);
     realm::CreatePolicy policy = realm::CreatePolicy::ForceCreate;
     if (args.count == 3) {
-        if (Value::is_boolean(ctx, args[2])) {
-            // Deprecated API
-            if (Value::validated_to_boolean(ctx, args[2])) {
-                policy = realm::CreatePolicy::UpdateAll;
-            }
-            else {
-                policy = realm::CreatePolicy::ForceCreate;
-            }
-        }
-        else if (Value::is_string(ctx, args[2])) {
-            // New API accepting an updateMode parameter
-            std::string mode = Value::validated_to_string(ctx, args[2]);
-            if (mode == "never") {
-                policy = realm::CreatePolicy::ForceCreate;
-            }
-            else if (mode == "modified") {
-                policy = realm::CreatePolicy::UpdateModified;
-            }
-            else if (mode == "all") {
-                policy = realm::CreatePolicy::UpdateAll;
-            } else {
-                throw std::runtime_error("Unsupported 'updateMode'. Only 'never', 'modified' or 'all' is supported.");
-            }
-        }
-        else {
-            throw std::runtime_error("Unsupported 'updateMode'. Only the strings 'never', 'modified' or 'all' is supported.");
-        }
+        policy = validated_create_policy(ctx, args[2]);
     }
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
@@ -1057,6 +1764,49 @@ void RealmClass<T>::create(ContextType ctx, ObjectType this_object, Arguments &a
     return_value.set(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
 }
 
+template<typename T>
+void RealmClass<T>::create_all(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(3);
+    realm::CreatePolicy policy = realm::CreatePolicy::ForceCreate;
+    if (args.count == 3) {
+        policy = validated_create_policy(ctx, args[2]);
+    }
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    realm->verify_open();
+    auto &object_schema = validated_object_schema_for_value(ctx, realm, args[0]);
+
+    ObjectType array = Value::validated_to_array(ctx, args[1], "objects");
+    uint32_t size = Object::validated_get_length(ctx, array);
+
+    // One accessor serves the whole batch, so the schema lookup and the
+    // per-schema caches it carries (interned property keys, resolved
+    // validators) are set up once instead of once per row.
+    NativeAccessor accessor(ctx, realm, object_schema);
+    std::vector<ValueType> created;
+    created.reserve(size);
+
+    for (uint32_t i = 0; i < size; i++) {
+        ValueType value = Object::get_property(ctx, array, i);
+        ObjectType object = Value::validated_to_object(ctx, value, "properties");
+        if (Value::is_array(ctx, value)) {
+            object = Schema<T>::dict_for_property_array(ctx, object_schema, object);
+        }
+
+        if (Object::template is_instance<RealmObjectClass<T>>(ctx, object)) {
+            auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, object);
+            if (!realm_object) {
+                throw std::runtime_error("Cannot create an object from a detached Realm.Object instance");
+            }
+        }
+
+        auto realm_object = realm::Object::create<ValueType>(accessor, realm, object_schema, object, policy);
+        created.push_back(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
+    }
+
+    return_value.set(Object::create_array(ctx, created));
+}
+
 template<typename T>
 void RealmClass<T>::delete_one(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(1);
@@ -1124,12 +1874,81 @@ void RealmClass<T>::delete_all(ContextType ctx, ObjectType this_object, Argument
         throw std::runtime_error("Can only delete objects within a transaction.");
     }
 
-    for (auto objectSchema : realm->schema()) {
+    // Reference, not copy: copying an ObjectSchema per table is measurable
+    // when fixtures wipe Realms with 100+ tables. Empty tables are skipped.
+    for (auto& objectSchema : realm->schema()) {
         auto table = ObjectStore::table_for_object_type(realm->read_group(), objectSchema.name);
-        table->clear();
+        if (table && !table->is_empty()) {
+            table->clear();
+        }
     }
 }
 
+// Wipes every table off the JS thread through a worker instance of the same
+// Realm, one write transaction per table so the write lock hold time and
+// history growth stay bounded on huge tables. Unlike deleteAll this must not
+// be called inside a transaction - the worker takes its own.
+template<typename T>
+void RealmClass<T>::delete_all_async(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+    auto callback = Value::validated_to_function(ctx, args[0], "callback");
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    realm->verify_open();
+    if (realm->is_in_transaction()) {
+        throw std::runtime_error("Cannot use deleteAllAsync within a transaction.");
+    }
+
+    Protected<FunctionType> protected_callback(ctx, callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    auto config = realm->config();
+
+    using DeleteAllCallbackHandler = void(std::exception_ptr error);
+    realm::util::EventLoopDispatcher<DeleteAllCallbackHandler> callback_handler(
+            [=](std::exception_ptr error) {
+        HANDLESCOPE(protected_ctx)
+
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            } catch (const std::exception& e) {
+                ObjectType object = Object::create_empty(protected_ctx);
+                Object::set_property(protected_ctx, object, "message", Value::from_string(protected_ctx, e.what()));
+
+                ValueType callback_arguments[1] = { object };
+                Function<T>::callback(protected_ctx, protected_callback, protected_this, 1, callback_arguments);
+                return;
+            }
+        }
+
+        ValueType callback_arguments[1] = { Value::from_null(protected_ctx) };
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 1, callback_arguments);
+    });
+
+    std::thread([config = std::move(config), handler = std::move(callback_handler)]() mutable {
+        try {
+            // The copied config must not keep the JS thread's scheduler (or
+            // its cached instance); this thread owns the writes it makes.
+            auto worker_realm = Realm::get_shared_realm(WorkerScheduler::adopt(std::move(config)));
+            for (auto& objectSchema : worker_realm->schema()) {
+                auto table = ObjectStore::table_for_object_type(worker_realm->read_group(), objectSchema.name);
+                if (!table || table->is_empty()) {
+                    continue;
+                }
+                worker_realm->begin_transaction();
+                table->clear();
+                worker_realm->commit_transaction();
+            }
+            handler(nullptr);
+        }
+        catch (...) {
+            handler(std::current_exception());
+        }
+    }).detach();
+}
+
 template<typename T>
 void RealmClass<T>::write(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(1);
@@ -1137,6 +1956,14 @@ void RealmClass<T>::write(ContextType ctx, ObjectType this_object, Arguments &ar
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
     FunctionType callback = Value::validated_to_function(ctx, args[0]);
 
+    // Includes the user callback, so the histogram measures the whole
+    // transaction as the application experiences it.
+    metrics::ScopedTimer timer(metrics::s_writes, metrics::s_write_micros);
+    tracing::ScopedTraceEvent trace("Realm.write");
+
+    // begin_transaction advances to the latest version; pin any pending
+    // copy-on-write snapshots first.
+    SnapshotPinRegistry::pin_all(realm.get());
     realm->begin_transaction();
 
     try {
@@ -1151,11 +1978,27 @@ void RealmClass<T>::write(ContextType ctx, ObjectType this_object, Arguments &ar
     realm->commit_transaction();
 }
 
+template<typename T>
+void RealmClass<T>::write_async(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    realm->verify_open();
+    FunctionType callback = Value::validated_to_function(ctx, args[0], "callback");
+    FunctionType completion = Value::validated_to_function(ctx, args[1], "completion");
+
+    get_delegate<T>(realm.get())->enqueue_async_write(callback, completion);
+}
+
 template<typename T>
 void RealmClass<T>::begin_transaction(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(0);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    // Mostly time spent waiting for the write lock and advancing the read
+    // transaction, which is exactly what a profile needs to show.
+    tracing::ScopedTraceEvent trace("Realm.beginTransaction");
+    SnapshotPinRegistry::pin_all(realm.get());
     realm->begin_transaction();
 }
 
@@ -1164,6 +2007,7 @@ void RealmClass<T>::commit_transaction(ContextType ctx, ObjectType this_object,
     args.validate_maximum(0);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    tracing::ScopedTraceEvent trace("Realm.commitTransaction");
     realm->commit_transaction();
 }
 
@@ -1250,6 +2094,7 @@ void RealmClass<T>::close(ContextType ctx, ObjectType this_object, Arguments &ar
     args.validate_maximum(0);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    SnapshotPinRegistry::erase(realm.get());
     realm->close();
 }
 
@@ -1265,6 +2110,150 @@ void RealmClass<T>::compact(ContextType ctx, ObjectType this_object, Arguments &
     return_value.set(realm->compact());
 }
 
+// Background compaction: a worker thread opens its own instance of the same
+// Realm and compacts there. Core's compaction takes an exclusive lock, so
+// this only succeeds while every instance is idle - no write transaction in
+// flight and no pinned versions - and reports false otherwise rather than
+// blocking; either way the JS thread never freezes for the copy.
+template<typename T>
+void RealmClass<T>::compact_async(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+    auto callback = Value::validated_to_function(ctx, args[0], "callback");
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    if (realm->is_in_transaction()) {
+        throw std::runtime_error("Cannot compact a Realm within a transaction.");
+    }
+
+    Protected<FunctionType> protected_callback(ctx, callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    auto config = realm->config();
+
+    using CompactCallbackHandler = void(bool compacted, std::exception_ptr error);
+    realm::util::EventLoopDispatcher<CompactCallbackHandler> callback_handler(
+            [=](bool compacted, std::exception_ptr error) {
+        HANDLESCOPE(protected_ctx)
+
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            } catch (const std::exception& e) {
+                ObjectType object = Object::create_empty(protected_ctx);
+                Object::set_property(protected_ctx, object, "message", Value::from_string(protected_ctx, e.what()));
+
+                ValueType callback_arguments[2] = {
+                    Value::from_undefined(protected_ctx),
+                    object,
+                };
+                Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+                return;
+            }
+        }
+
+        ValueType callback_arguments[2] = {
+            Value::from_boolean(protected_ctx, compacted),
+            Value::from_null(protected_ctx),
+        };
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+    });
+
+    std::thread([config = std::move(config), handler = std::move(callback_handler)]() mutable {
+        try {
+            // Rebuild the copied config for this thread: worker-owned
+            // scheduler, no cache, so compact() passes the thread check and
+            // never runs against the JS thread's instance.
+            auto worker_realm = Realm::get_shared_realm(WorkerScheduler::adopt(std::move(config)));
+            handler(worker_realm->compact(), nullptr);
+        }
+        catch (...) {
+            handler(false, std::current_exception());
+        }
+    }).detach();
+}
+
+template<typename T>
+void RealmClass<T>::memory_usage(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+
+    // The file size is the ceiling on what pinned versions can cost; paired
+    // with the version count it lets telemetry flag version-pinning leaks
+    // (a long-lived snapshot or transaction holding history alive) without
+    // walking the JS heap.
+    uint64_t file_size = 0;
+    try {
+        file_size = util::File::get_size_static(realm->config().path);
+    }
+    catch (...) {
+        // in-memory Realm or the file is gone; report zero
+    }
+
+    return_value.set(Object::create_obj(ctx, {
+        {"fileSize", Value::from_number(ctx, static_cast<double>(file_size))},
+        {"numberOfVersions", Value::from_number(ctx, static_cast<double>(realm->get_number_of_versions()))},
+        {"pendingSnapshotPins", Value::from_number(ctx, static_cast<double>(SnapshotPinRegistry::pending_count(realm.get())))},
+        {"wrappedObjects", Value::from_number(ctx, static_cast<double>(metrics::s_live_wrapped_objects.load(std::memory_order_relaxed)))},
+        {"protectedReferences", Value::from_number(ctx, static_cast<double>(metrics::s_live_protected_refs.load(std::memory_order_relaxed)))},
+        {"notificationQueueDepth", Value::from_number(ctx, static_cast<double>(NotificationBatcher::pending_count()))},
+    }));
+}
+
+template<typename T>
+void RealmClass<T>::import_handover(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    auto handle = static_cast<int64_t>(Value::validated_to_number(ctx, args[0], "handle"));
+
+    // Resolving consumes the reference: a handle imports exactly once. Each
+    // worker gets its own handle from a separate _export() call on the
+    // coordinator side.
+    auto ref = HandoverRegistry::take(handle);
+    return_value.set(ResultsClass<T>::create_instance(ctx, ref.template resolve<realm::Results>(realm)));
+}
+
+template<typename T>
+void RealmClass<T>::enqueue_write(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    auto command = String::to_bson(Value::validated_to_string(ctx, args[0], "command"));
+    if (command.type() != bson::Bson::Type::Document) {
+        throw std::invalid_argument("Writer-queue command must be an EJSON document");
+    }
+    auto callback = Value::validated_to_function(ctx, args[1], "callback");
+
+    Protected<FunctionType> protected_callback(ctx, callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    util::EventLoopDispatcher<void(std::exception_ptr)> completion([=](std::exception_ptr error) {
+        HANDLESCOPE(protected_ctx)
+
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            }
+            catch (const std::exception& e) {
+                ObjectType object = Object::create_empty(protected_ctx);
+                Object::set_property(protected_ctx, object, "message", Value::from_string(protected_ctx, e.what()));
+
+                ValueType callback_arguments[1] = {object};
+                Function<T>::callback(protected_ctx, protected_callback, protected_this, 1, callback_arguments);
+                return;
+            }
+        }
+        ValueType callback_arguments[1] = {Value::from_undefined(protected_ctx)};
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 1, callback_arguments);
+    });
+
+    WriterQueue::for_path(realm->config())
+        .enqueue(bson::BsonDocument(command.operator const bson::BsonDocument&()), std::move(completion));
+}
+
 template<typename T>
 void RealmClass<T>::writeCopyTo(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     args.validate_maximum(2);
@@ -1301,6 +2290,59 @@ void RealmClass<T>::writeCopyTo(ContextType ctx, ObjectType this_object, Argumen
     realm->write_copy(path, encryption_key.get());
 }
 
+template<typename T>
+void RealmClass<T>::writeCopyToAsync(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(3);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    std::string path = Value::validated_to_string(ctx, args[0], "path");
+
+    std::vector<char> encryption_key;
+    if (!Value::is_undefined(ctx, args[1]) && !Value::is_null(ctx, args[1])) {
+        auto key = Value::validated_to_binary(ctx, args[1], "encryptionKey");
+        encryption_key.assign(key.data(), key.data() + key.size());
+    }
+    FunctionType callback = Value::validated_to_function(ctx, args[2], "callback");
+
+    Protected<FunctionType> protected_callback(ctx, callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    // A frozen Realm pins the current version and may be read from any
+    // thread, which is what lets the copy run off the JS thread.
+    SharedRealm frozen = realm->freeze();
+
+    util::EventLoopDispatcher<void(std::exception_ptr)> completion([=](std::exception_ptr error) {
+        HANDLESCOPE(protected_ctx)
+        ValueType callback_arguments[1] = {Value::from_undefined(protected_ctx)};
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            }
+            catch (const std::exception& e) {
+                ObjectType object = Object::create_empty(protected_ctx);
+                Object::set_property(protected_ctx, object, "message", Value::from_string(protected_ctx, e.what()));
+                callback_arguments[0] = object;
+            }
+        }
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 1, callback_arguments);
+    });
+
+    std::thread([frozen, path = std::move(path), encryption_key = std::move(encryption_key), completion]() mutable {
+        std::exception_ptr error;
+        try {
+            frozen->write_copy(path, encryption_key.empty() ? BinaryData()
+                                                            : BinaryData(encryption_key.data(), encryption_key.size()));
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        frozen->close();
+        frozen.reset();
+        completion(error);
+    }).detach();
+}
+
 template<typename T>
 void RealmClass<T>::get_schema_name_from_object(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue& return_value) {
     args.validate_count(1);
@@ -1344,14 +2386,102 @@ void RealmClass<T>::update_schema(ContextType ctx, ObjectType this_object, Argum
     );
 }
 
+template<typename T>
+void RealmClass<T>::update_schema_incremental(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+    ObjectType schema = Value::validated_to_array(ctx, args[0], "schema");
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    if (!realm->is_in_transaction()) {
+        throw std::runtime_error("Can only create object schema within a transaction.");
+    }
+
+    // Parse only the supplied object schemas and overlay them on the Realm's
+    // current schema, so rolling out a change to one class doesn't pay for
+    // re-parsing and re-validating the full definition.
+    ObjectDefaultsMap defaults;
+    ConstructorMap constructors;
+    realm::Schema partial_schema = Schema<T>::parse_schema(ctx, schema, defaults, constructors);
+
+    std::vector<ObjectSchema> merged(realm->schema().begin(), realm->schema().end());
+    for (auto &object_schema : partial_schema) {
+        auto it = std::find_if(merged.begin(), merged.end(), [&](auto &existing) {
+            return existing.name == object_schema.name;
+        });
+        if (it != merged.end()) {
+            *it = object_schema;
+        }
+        else {
+            merged.push_back(object_schema);
+        }
+    }
+
+    realm->update_schema(
+        realm::Schema(merged),
+        realm->schema_version() + 1,
+        nullptr,
+        nullptr,
+        true
+    );
+}
+
 template<typename T>
 void RealmClass<T>::bson_parse_json(ContextType ctx, ObjectType, Arguments& args, ReturnValue &return_value) {
     args.validate_count(1);
-    auto json = std::string(Value::validated_to_string(ctx, args[0]));
-    auto parsed = bson::parse(json);
+    auto parsed = String::to_bson(Value::validated_to_string(ctx, args[0]));
     return_value.set(Value::from_bson(ctx, parsed));
 }
 
+template<typename T>
+void RealmClass<T>::set_metrics_enabled(ContextType ctx, ObjectType, Arguments& args, ReturnValue &return_value) {
+    args.validate_count(1);
+    metrics::s_enabled.store(Value::to_boolean(ctx, args[0]), std::memory_order_relaxed);
+}
+
+template<typename T>
+void RealmClass<T>::get_metrics(ContextType ctx, ObjectType, Arguments& args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+
+    auto histogram_to_array = [&](metrics::Histogram& histogram) {
+        std::vector<ValueType> buckets;
+        buckets.reserve(metrics::Histogram::num_buckets);
+        for (auto& bucket : histogram.buckets) {
+            buckets.push_back(Value::from_number(ctx, static_cast<double>(bucket.load(std::memory_order_relaxed))));
+        }
+        return Object::create_array(ctx, buckets);
+    };
+
+    auto counter = [&](std::atomic<uint64_t>& value) {
+        return Value::from_number(ctx, static_cast<double>(value.load(std::memory_order_relaxed)));
+    };
+
+    // The property counters are sampled estimates (each sampled hit adds the
+    // ratio); the parse/write counters and histograms are exact.
+    return_value.set(Object::create_obj(ctx, {
+        {"enabled", Value::from_boolean(ctx, metrics::s_enabled.load(std::memory_order_relaxed))},
+        {"propertySampleRatio", Value::from_number(ctx, metrics::s_property_sample_ratio.load(std::memory_order_relaxed))},
+        {"propertyGets", counter(metrics::s_property_gets)},
+        {"propertySets", counter(metrics::s_property_sets)},
+        {"queriesParsed", counter(metrics::s_queries_parsed)},
+        {"writes", counter(metrics::s_writes)},
+        {"queryParseMicros", histogram_to_array(metrics::s_query_parse_micros)},
+        {"writeMicros", histogram_to_array(metrics::s_write_micros)},
+    }));
+}
+
+template<typename T>
+void RealmClass<T>::start_trace(ContextType ctx, ObjectType, Arguments& args, ReturnValue &return_value) {
+    args.validate_count(1);
+    std::string path = Value::validated_to_string(ctx, args[0], "path");
+    tracing::TraceFile::shared().start(path);
+}
+
+template<typename T>
+void RealmClass<T>::stop_trace(ContextType ctx, ObjectType, Arguments& args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+    tracing::TraceFile::shared().stop();
+}
+
 #if REALM_ENABLE_SYNC
 template<typename T>
 class AsyncOpenTaskClass : public ClassDefinition<T, std::shared_ptr<AsyncOpenTask>> {
@@ -24,6 +24,7 @@ namespace js {
 }
 }
 
+#include <realm/object-store/list.hpp>
 #include <realm/object-store/object_accessor.hpp>
 #include <realm/object-store/object_store.hpp>
 
@@ -69,6 +70,8 @@ struct RealmObjectClass : ClassDefinition<T, realm::js::RealmObject<T>> {
     static bool set_property(ContextType, ObjectType, const String &, ValueType);
     static std::vector<String> get_property_names(ContextType, ObjectType);
 
+    static void freeze(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void get_is_frozen(ContextType, ObjectType, ReturnValue &);
     static void is_valid(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void get_object_schema(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void linking_objects(ContextType, ObjectType, Arguments &, ReturnValue &);
@@ -80,6 +83,11 @@ struct RealmObjectClass : ClassDefinition<T, realm::js::RealmObject<T>> {
     static void remove_listener(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void remove_all_listeners(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void get_property_type(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void to_json(ContextType, ObjectType, Arguments &, ReturnValue &);
+
+    // Serializes a managed object to a plain JS object in one native pass over
+    // its schema; used by _toJSON on objects and collections.
+    static ValueType serialize(ContextType, realm::Object &, size_t depth);
 
     static void get_realm(ContextType, ObjectType, ReturnValue &);
 
@@ -103,13 +111,39 @@ struct RealmObjectClass : ClassDefinition<T, realm::js::RealmObject<T>> {
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
         {"getPropertyType", wrap<get_property_type>},
+        {"_toJSON", wrap<to_json>},
+        {"freeze", wrap<freeze>},
     };
 
     PropertyMap<T> const properties = {
         {"_realm", {wrap<get_realm>, nullptr}},
+        {"isFrozen", {wrap<get_is_frozen>, nullptr}},
     };
 };
 
+template<typename T>
+void RealmObjectClass<T>::freeze(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, this_object);
+    if (!realm_object) {
+        throw std::runtime_error("Invalid 'this' object");
+    }
+    // Freezing pins the current version; the frozen wrapper never advances,
+    // never notifies, and may be read from any thread.
+    auto frozen_realm = realm_object->realm()->freeze();
+    return_value.set(create_instance(ctx, realm::js::RealmObject<T>(realm_object->freeze(frozen_realm))));
+}
+
+template<typename T>
+void RealmObjectClass<T>::get_is_frozen(ContextType ctx, ObjectType this_object, ReturnValue &return_value) {
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, this_object);
+    if (!realm_object) {
+        throw std::runtime_error("Invalid 'this' object");
+    }
+    return_value.set(realm_object->is_frozen());
+}
+
 template<typename T>
 void RealmObjectClass<T>::is_valid(ContextType ctx, ObjectType this_object, Arguments &, ReturnValue &return_value) {
     auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, this_object);
@@ -128,6 +162,81 @@ void RealmObjectClass<T>::get_object_schema(ContextType ctx, ObjectType this_obj
     return_value.set(Schema<T>::object_for_object_schema(ctx, realm_object->get_object_schema()));
 }
 
+template<typename T>
+typename T::Value RealmObjectClass<T>::serialize(ContextType ctx, realm::Object &realm_object, size_t depth) {
+    auto realm = realm_object.realm();
+    auto& object_schema = realm_object.get_object_schema();
+    auto obj = realm_object.obj();
+
+    // One accessor and one schema walk for the whole object; links and lists of
+    // links recurse until `depth` is exhausted and serialize as null beyond it.
+    // Sets, dictionaries and mixed values keep their regular boxed form.
+    NativeAccessor<T> accessor(ctx, realm, object_schema);
+    auto result = Object::create_empty(ctx);
+
+    for (auto& property : object_schema.persisted_properties) {
+        auto& name = !property.public_name.empty() ? property.public_name : property.name;
+        auto base_type = property.type & ~realm::PropertyType::Flags;
+
+        if (base_type == realm::PropertyType::Object && !realm::is_array(property.type)
+                && !realm::is_set(property.type) && !realm::is_dictionary(property.type)) {
+            auto link = obj.template get<ObjKey>(property.column_key);
+            if (!link || depth == 0) {
+                Object::set_property(ctx, result, name, Value::from_null(ctx));
+            }
+            else {
+                auto linked = realm::Object(realm, property.object_type, link);
+                Object::set_property(ctx, result, name, serialize(ctx, linked, depth - 1));
+            }
+        }
+        else if (realm::is_array(property.type)) {
+            realm::List list(realm, obj, property.column_key);
+            size_t size = list.size();
+            std::vector<ValueType> values;
+            values.reserve(size);
+
+            if (base_type == realm::PropertyType::Object) {
+                for (size_t i = 0; i < size; i++) {
+                    if (depth == 0) {
+                        values.push_back(Value::from_null(ctx));
+                    }
+                    else {
+                        auto linked = realm::Object(realm, property.object_type, list.template get<Obj>(i).get_key());
+                        values.push_back(serialize(ctx, linked, depth - 1));
+                    }
+                }
+            }
+            else {
+                NativeAccessor<T> list_accessor(ctx, list);
+                for (size_t i = 0; i < size; i++) {
+                    values.push_back(list.get(list_accessor, i));
+                }
+            }
+            Object::set_property(ctx, result, name, Object::create_array(ctx, values));
+        }
+        else {
+            Object::set_property(ctx, result, name,
+                                 realm_object.template get_property_value<ValueType>(accessor, property));
+        }
+    }
+    return result;
+}
+
+template<typename T>
+void RealmObjectClass<T>::to_json(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(1);
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, this_object);
+    if (!realm_object) {
+        throw std::runtime_error("Invalid 'this' object");
+    }
+
+    size_t depth = 1;
+    if (args.count > 0 && !Value::is_undefined(ctx, args[0])) {
+        depth = Value::validated_to_number(ctx, args[0], "depth");
+    }
+    return_value.set(serialize(ctx, *realm_object, depth));
+}
+
 template<typename T>
 typename T::Object RealmObjectClass<T>::create_instance(ContextType ctx, realm::js::RealmObject<T> realm_object) {
     static String prototype_string = "prototype";
@@ -136,16 +245,34 @@ typename T::Object RealmObjectClass<T>::create_instance(ContextType ctx, realm::
     auto& schema = realm_object.get_object_schema();
     auto& name = schema.name;
 
+    // Boxing the same row twice should yield the same wrapper; consult the
+    // per-Realm identity map before allocating a new instance.
+    bool cacheable = delegate && realm_object.is_valid();
+    TableKey table_key;
+    ObjKey obj_key;
+    if (cacheable) {
+        table_key = realm_object.obj().get_table()->get_key();
+        obj_key = realm_object.obj().get_key();
+        if (auto cached = delegate->get_cached_object(table_key, obj_key)) {
+            return *cached;
+        }
+    }
+
     auto internal = new realm::js::RealmObject<T>(std::move(realm_object));
 
     try {
+        ObjectType object{};
         if (!delegate || !delegate->m_constructors.count(name)) {
-            return create_instance_by_schema<T, RealmObjectClass<T>>(ctx, schema, internal);
+            object = create_instance_by_schema<T, RealmObjectClass<T>>(ctx, schema, internal);
+        }
+        else {
+            FunctionType constructor = delegate->m_constructors.at(name);
+            object = create_instance_by_schema<T, RealmObjectClass<T>>(ctx, constructor, schema, internal);
         }
 
-        FunctionType constructor = delegate->m_constructors.at(name);
-        auto object = create_instance_by_schema<T, RealmObjectClass<T>>(ctx, constructor, schema, internal);
-
+        if (cacheable) {
+            delegate->cache_object(table_key, obj_key, object);
+        }
         return object;
     }
     catch (const std::exception& e) {
@@ -341,7 +468,7 @@ void RealmObjectClass<T>::linking_objects_count(ContextType ctx, ObjectType obje
 
 template<typename T>
 void RealmObjectClass<T>::add_listener(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue& return_value) {
-    args.validate_maximum(1);
+    args.validate_maximum(2);
 
     auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, this_object);
     if (!realm_object) {
@@ -349,11 +476,41 @@ void RealmObjectClass<T>::add_listener(ContextType ctx, ObjectType this_object,
     }
 
     auto callback = Value::validated_to_function(ctx, args[0]);
+
+    // Optional list of property names; changesets touching none of them are
+    // dropped natively instead of waking the JS handler. Names resolve to
+    // column keys once, at registration.
+    std::vector<ColKey> filter_columns;
+    if (args.count > 1 && !Value::is_undefined(ctx, args[1])) {
+        auto names = Value::validated_to_array(ctx, args[1], "propertyNames");
+        uint32_t name_count = Object::validated_get_length(ctx, names);
+        auto& object_schema = realm_object->get_object_schema();
+        filter_columns.reserve(name_count);
+        for (uint32_t i = 0; i < name_count; i++) {
+            std::string name = Object::validated_get_string(ctx, names, i);
+            const Property* property = object_schema.property_for_name(name);
+            if (!property) {
+                throw std::invalid_argument("Property '" + name + "' does not exist on type '" + object_schema.name + "'");
+            }
+            filter_columns.push_back(property->column_key);
+        }
+    }
+
     Protected<FunctionType> protected_callback(ctx, callback);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
 
     auto token = realm_object->add_notification_callback([=](CollectionChangeSet const& change_set, std::exception_ptr exception) {
+            if (!filter_columns.empty() && change_set.deletions.empty()) {
+                auto touched = std::any_of(filter_columns.begin(), filter_columns.end(), [&](ColKey col) {
+                    auto it = change_set.columns.find(col.value);
+                    return it != change_set.columns.end() && !it->second.empty();
+                });
+                if (!touched) {
+                    return;
+                }
+            }
+
             HANDLESCOPE(protected_ctx)
 
             bool deleted = false;
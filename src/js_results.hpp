@@ -21,11 +21,19 @@
 #include "js_collection.hpp"
 #include "js_realm_object.hpp"
 #include "js_util.hpp"
+#include "metrics.hpp"
 
 #include <realm/object-store/keypath_helpers.hpp>
 #include <realm/object-store/list.hpp>
 #include <realm/object-store/object_store.hpp>
 #include <realm/object-store/results.hpp>
+#include <realm/object-store/thread_safe_reference.hpp>
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 #include <realm/parser/query_parser.hpp>
 #include <realm/util/optional.hpp>
@@ -43,6 +51,179 @@ struct NonRealmObjectException : public std::logic_error {
     NonRealmObjectException() : std::logic_error("Object is not a Realm object") { }
 };
 
+// Small LRU of parsed argument-free predicates, used by ResultsClass::create_filtered.
+// A parsed Query is bound to the collection's Realm, so keeping the cache on the
+// collection wrapper aligns the lifetimes; predicates with placeholder arguments
+// bake the argument values into the parse and are not cacheable.
+class FilteredQueryCache {
+  public:
+    struct Entry {
+        std::string query_string;
+        Query query;
+        util::Optional<DescriptorOrdering> ordering;
+    };
+
+    Entry* find(const std::string& query_string) {
+        auto it = std::find_if(m_entries.begin(), m_entries.end(), [&](auto& entry) {
+            return entry.query_string == query_string;
+        });
+        if (it == m_entries.end()) {
+            return nullptr;
+        }
+        std::rotate(m_entries.begin(), it, it + 1);
+        return &m_entries.front();
+    }
+
+    void insert(std::string query_string, Query query, util::Optional<DescriptorOrdering> ordering) {
+        if (m_entries.size() >= s_max_entries) {
+            m_entries.pop_back();
+        }
+        m_entries.insert(m_entries.begin(), {std::move(query_string), std::move(query), std::move(ordering)});
+    }
+
+  private:
+    static constexpr size_t s_max_entries = 16;
+    std::vector<Entry> m_entries;
+};
+
+// Cache of sort descriptors resolved to column keys, keyed by the
+// (keypath, ascending) list passed to sorted(); see ResultsClass::create_sorted.
+class SortDescriptorCache {
+  public:
+    using Key = std::vector<std::pair<std::string, bool>>;
+
+    SortDescriptor* find(const Key& key) {
+        auto it = std::find_if(m_entries.begin(), m_entries.end(), [&](auto& entry) {
+            return entry.first == key;
+        });
+        if (it == m_entries.end()) {
+            return nullptr;
+        }
+        std::rotate(m_entries.begin(), it, it + 1);
+        return &m_entries.front().second;
+    }
+
+    void insert(Key key, SortDescriptor descriptor) {
+        if (m_entries.size() >= s_max_entries) {
+            m_entries.pop_back();
+        }
+        m_entries.insert(m_entries.begin(), {std::move(key), std::move(descriptor)});
+    }
+
+  private:
+    static constexpr size_t s_max_entries = 16;
+    std::vector<std::pair<Key, SortDescriptor>> m_entries;
+};
+
+// Pending copy-on-write snapshots, keyed by the Realm they observe. A lazy
+// snapshot serves reads straight from the live view and only materializes a
+// core snapshot when its Realm is about to move to another version (local
+// write or notification delivery), so the common snapshot-then-iterate
+// pattern never pays for a pinned table view. Entries are held weakly; a
+// garbage-collected snapshot simply drops out of the list.
+class SnapshotPinRegistry {
+  public:
+    using PinFunction = std::function<void()>;
+
+    static void add(const realm::Realm* realm, std::weak_ptr<PinFunction> pin) {
+        std::lock_guard<std::mutex> lock(state().mutex);
+        state().pins[realm].push_back(std::move(pin));
+    }
+
+    // Invoked right before `realm` advances its read version; pins and drops
+    // every snapshot still pending for it.
+    static void pin_all(const realm::Realm* realm) {
+        std::vector<std::shared_ptr<PinFunction>> to_pin;
+        {
+            std::lock_guard<std::mutex> lock(state().mutex);
+            auto it = state().pins.find(realm);
+            if (it == state().pins.end()) {
+                return;
+            }
+            for (auto& weak_pin : it->second) {
+                if (auto pin = weak_pin.lock()) {
+                    to_pin.push_back(std::move(pin));
+                }
+            }
+            state().pins.erase(it);
+        }
+        for (auto& pin : to_pin) {
+            (*pin)();
+        }
+    }
+
+    static void erase(const realm::Realm* realm) {
+        std::lock_guard<std::mutex> lock(state().mutex);
+        state().pins.erase(realm);
+    }
+
+    // Snapshots still pending (alive but not yet pinned) for `realm`; a
+    // persistently high count means long-lived snapshots are pinning old
+    // versions. See RealmClass::memory_usage.
+    static size_t pending_count(const realm::Realm* realm) {
+        std::lock_guard<std::mutex> lock(state().mutex);
+        auto it = state().pins.find(realm);
+        if (it == state().pins.end()) {
+            return 0;
+        }
+        size_t count = 0;
+        for (auto& weak_pin : it->second) {
+            if (!weak_pin.expired()) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+  private:
+    struct State {
+        std::mutex mutex;
+        std::map<const realm::Realm*, std::vector<std::weak_ptr<PinFunction>>> pins;
+    };
+    static State& state() {
+        static State s_state;
+        return s_state;
+    }
+};
+
+// Process-wide store backing Results._export() / realm._import(). A
+// ThreadSafeReference may only be resolved once and cannot travel through
+// postMessage, so the reference stays native-side under a numeric token;
+// node worker_threads share the addon's static storage, which makes the
+// token valid across workers in the same process. Taking a handle consumes
+// it.
+class HandoverRegistry {
+  public:
+    static int64_t put(ThreadSafeReference ref) {
+        std::lock_guard<std::mutex> lock(state().mutex);
+        auto id = ++state().next_id;
+        state().refs.emplace(id, std::move(ref));
+        return id;
+    }
+
+    static ThreadSafeReference take(int64_t handle) {
+        std::lock_guard<std::mutex> lock(state().mutex);
+        auto it = state().refs.find(handle);
+        if (it == state().refs.end()) {
+            throw std::invalid_argument("Unknown or already imported handover handle");
+        }
+        auto ref = std::move(it->second);
+        state().refs.erase(it);
+        return ref;
+    }
+
+  private:
+    struct State {
+        std::mutex mutex;
+        int64_t next_id = 0;
+        std::map<int64_t, ThreadSafeReference> refs;
+    };
+    static State& state() {
+        static State s_state;
+        return s_state;
+    }
+};
+
 template<typename T>
 class Results : public realm::Results {
   public:
@@ -55,8 +236,102 @@ class Results : public realm::Results {
     using realm::Results::Results;
 
     std::vector<std::pair<Protected<typename T::Function>, NotificationToken>> m_notification_tokens;
+
+    // Cached size() stamped with the read-transaction version it was computed
+    // under, so repeated `.length` reads within one version skip the core call.
+    // See ResultsClass::get_length.
+    util::Optional<size_t> m_cached_size;
+    VersionID m_cached_size_version;
+
+    // Mutable because create_filtered only sees the collection by const reference.
+    mutable FilteredQueryCache m_filtered_query_cache;
+
+    SortDescriptorCache m_sort_descriptor_cache;
+
+    // Owns this wrapper's pending pin callback while it is a copy-on-write
+    // snapshot; the SnapshotPinRegistry only holds it weakly.
+    std::shared_ptr<SnapshotPinRegistry::PinFunction> m_snapshot_pin;
+};
+
+// Forward cursor over a Results; see ResultsClass::cursor. Unlike snapshot()
+// this does not pin a full table view, it only remembers how far iteration
+// has progressed, so arbitrarily large result sets stream with bounded memory.
+template<typename T>
+class ResultsCursor {
+  public:
+    ResultsCursor(realm::Results results) : m_results(std::move(results)) { }
+
+    realm::Results m_results;
+    size_t m_position = 0;
 };
 
+template<typename T>
+struct CursorClass : ClassDefinition<T, ResultsCursor<T>> {
+    using Type = T;
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+    using ValueType = typename T::Value;
+    using Object = js::Object<T>;
+    using Value = js::Value<T>;
+    using ReturnValue = js::ReturnValue<T>;
+    using Arguments = js::Arguments<T>;
+
+    static ObjectType create_instance(ContextType, realm::Results);
+
+    static void next(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void get_position(ContextType, ObjectType, ReturnValue &);
+
+    std::string const name = "ResultsCursor";
+
+    MethodMap<T> const methods = {
+        {"next", wrap<next>},
+    };
+
+    PropertyMap<T> const properties = {
+        {"position", {wrap<get_position>, nullptr}},
+    };
+};
+
+template<typename T>
+typename T::Object CursorClass<T>::create_instance(ContextType ctx, realm::Results results) {
+    return create_object<T, CursorClass<T>>(ctx, new ResultsCursor<T>(std::move(results)));
+}
+
+template<typename T>
+void CursorClass<T>::next(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(1);
+    auto cursor = get_internal<T, CursorClass<T>>(ctx, this_object);
+
+    size_t batch_size = 1000;
+    if (args.count > 0 && !Value::is_undefined(ctx, args[0])) {
+        batch_size = Value::validated_to_number(ctx, args[0], "batchSize");
+    }
+
+    size_t size = cursor->m_results.size();
+    size_t start = std::min(cursor->m_position, size);
+    size_t end = std::min(start + batch_size, size);
+
+    std::vector<ValueType> values;
+    values.reserve(end - start);
+
+    NativeAccessor<T> accessor(ctx, cursor->m_results);
+    for (size_t i = start; i < end; i++) {
+        values.push_back(cursor->m_results.get(accessor, i));
+    }
+    cursor->m_position = end;
+
+    return_value.set(Object::create_obj(ctx, {
+        {"values", Object::create_array(ctx, values)},
+        {"done", Value::from_boolean(ctx, end >= size)},
+    }));
+}
+
+template<typename T>
+void CursorClass<T>::get_position(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    auto cursor = get_internal<T, CursorClass<T>>(ctx, object);
+    return_value.set((uint32_t)cursor->m_position);
+}
+
 template<typename T>
 struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<T>> {
     using Type = T;
@@ -71,10 +346,20 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
 
     static ObjectType create_instance(ContextType, realm::Results);
     static ObjectType create_instance(ContextType, SharedRealm, const std::string &object_type);
+    static ObjectType create_lazy_snapshot(ContextType, realm::List&);
 
     template<typename U>
     static ObjectType create_filtered(ContextType, const U &, Arguments &);
 
+    template<typename U>
+    static ObjectType create_slice(ContextType, U &, Arguments &);
+
+    template<typename U>
+    static ObjectType create_json(ContextType, U &, Arguments &);
+
+    template<typename U>
+    static ObjectType create_sorted(ContextType, U &, Arguments &);
+
     static std::vector<std::pair<std::string, bool>> get_keypaths(ContextType, Arguments &);
 
     static void get_length(ContextType, ObjectType, ReturnValue &);
@@ -83,13 +368,22 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
     static void get_index(ContextType, ObjectType, uint32_t, ReturnValue &);
 
     static void description(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void cursor(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void slice(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void window(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void to_json(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void snapshot(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void filtered(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void filtered_async(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void sorted(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void sorted_async(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void is_valid(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void is_empty(ContextType, ObjectType, Arguments &, ReturnValue &);
 
     static void index_of(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void export_for_handover(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void freeze(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void get_is_frozen(ContextType, ObjectType, ReturnValue &);
 
     template<typename Fn>
     static void index_of(ContextType, Fn&, Arguments &, ReturnValue &);
@@ -110,26 +404,36 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
 
     MethodMap<T> const methods = {
         {"description", wrap<description>},
+        {"cursor", wrap<cursor>},
+        {"slice", wrap<slice>},
+        {"window", wrap<window>},
+        {"_toJSON", wrap<to_json>},
         {"snapshot", wrap<snapshot>},
         {"filtered", wrap<filtered>},
+        {"_filteredAsync", wrap<filtered_async>},
         {"sorted", wrap<sorted>},
+        {"_sortedAsync", wrap<sorted_async>},
         {"isValid", wrap<is_valid>},
         {"isEmpty", wrap<is_empty>},
         {"min", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Min>>},
         {"max", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Max>>},
         {"sum", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Sum>>},
         {"avg", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Avg>>},
+        {"count", wrap<compute_count_on_collection<ResultsClass<T>>>},
         {"addListener", wrap<add_listener>},
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
         {"indexOf", wrap<index_of>},
         {"update", wrap<update>},
+        {"_export", wrap<export_for_handover>},
+        {"freeze", wrap<freeze>},
     };
 
     PropertyMap<T> const properties = {
         {"length", {wrap<get_length>, nullptr}},
         {"type", {wrap<get_type>, nullptr}},
         {"optional", {wrap<get_optional>, nullptr}},
+        {"isFrozen", {wrap<get_is_frozen>, nullptr}},
     };
 
     IndexPropertyType<T> const index_accessor = {wrap<get_index>, nullptr};
@@ -149,18 +453,44 @@ typename T::Object ResultsClass<T>::create_instance(ContextType ctx, SharedRealm
     return create_object<T, ResultsClass<T>>(ctx, new realm::js::Results<T>(realm, table));
 }
 
+template<typename T>
+typename T::Object ResultsClass<T>::create_lazy_snapshot(ContextType ctx, realm::List& list) {
+    auto wrapper = new realm::js::Results<T>(list.as_results());
+    // Reads go through the live view until the Realm is about to change
+    // version, at which point the registry fires this pin and the wrapper
+    // swaps in a real core snapshot of the pre-change state.
+    auto pin = std::make_shared<SnapshotPinRegistry::PinFunction>([wrapper, list = realm::List(list)] {
+        static_cast<realm::Results&>(*wrapper) = list.snapshot();
+    });
+    wrapper->m_snapshot_pin = pin;
+    SnapshotPinRegistry::add(list.get_realm().get(), pin);
+    return create_object<T, ResultsClass<T>>(ctx, wrapper);
+}
+
 template<typename T>
 template<typename U>
 typename T::Object ResultsClass<T>::create_filtered(ContextType ctx, const U &collection, Arguments &args) {
+    metrics::ScopedTimer timer(metrics::s_queries_parsed, metrics::s_query_parse_micros);
     if (collection.get_type() != realm::PropertyType::Object) {
         throw std::runtime_error("Filtering non-object Lists and Results is not yet implemented.");
     }
 
-    auto query_string = Value::validated_to_string(ctx, args[0], "predicate");
+    std::string query_string = Value::validated_to_string(ctx, args[0], "predicate");
 
     auto const &realm = collection.get_realm();
     auto const &object_schema = collection.get_object_schema();
 
+    bool cacheable = args.count == 1;
+    if (cacheable) {
+        if (auto entry = collection.m_filtered_query_cache.find(query_string)) {
+            auto filtered = collection.filter(Query(entry->query));
+            if (entry->ordering)
+                return create_instance(ctx, filtered.apply_ordering(DescriptorOrdering(*entry->ordering)));
+            else
+                return create_instance(ctx, std::move(filtered));
+        }
+    }
+
     query_parser::KeyPathMapping mapping;
     realm::populate_keypath_mapping(mapping, *realm);
     NativeAccessor<T> accessor(ctx, realm, object_schema);
@@ -169,12 +499,121 @@ typename T::Object ResultsClass<T>::create_filtered(ContextType ctx, const U &co
     auto table = realm->read_group().get_table(object_schema.table_key);
     auto query = table->query(query_string, converter, mapping);
     auto ordering = query.get_ordering();
+    if (cacheable) {
+        collection.m_filtered_query_cache.insert(query_string, Query(query),
+                                                 ordering ? util::make_optional(DescriptorOrdering(*ordering))
+                                                          : util::none);
+    }
     if (ordering)
         return create_instance(ctx, collection.filter(std::move(query)).apply_ordering(std::move(*ordering)));
     else
         return create_instance(ctx, collection.filter(std::move(query)));
 }
 
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_slice(ContextType ctx, U &collection, Arguments &args) {
+    args.validate_maximum(2);
+
+    // Same semantics as Array.prototype.slice, which this replaces on collections.
+    long size = static_cast<long>(collection.size());
+    auto clamp = [&](long index) {
+        if (index < 0) {
+            index = std::max<long>(size + index, 0);
+        }
+        return std::min<long>(index, size);
+    };
+
+    long start = 0;
+    if (args.count > 0 && !Value::is_undefined(ctx, args[0])) {
+        start = clamp(Value::validated_to_number(ctx, args[0], "start"));
+    }
+    long end = size;
+    if (args.count > 1 && !Value::is_undefined(ctx, args[1])) {
+        end = clamp(Value::validated_to_number(ctx, args[1], "end"));
+    }
+
+    // Materializing the whole batch through one accessor shares the object schema
+    // lookup and avoids a JS->native crossing per element.
+    std::vector<ValueType> values;
+    values.reserve(std::max<long>(end - start, 0));
+
+    NativeAccessor<T> accessor(ctx, collection);
+    for (long i = start; i < end; i++) {
+        values.push_back(collection.get(accessor, i));
+    }
+    return Object::create_array(ctx, values);
+}
+
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_json(ContextType ctx, U &collection, Arguments &args) {
+    args.validate_maximum(1);
+
+    size_t depth = 1;
+    if (args.count > 0 && !Value::is_undefined(ctx, args[0])) {
+        depth = Value::validated_to_number(ctx, args[0], "depth");
+    }
+
+    size_t size = collection.size();
+    std::vector<ValueType> values;
+    values.reserve(size);
+
+    if (collection.get_type() != realm::PropertyType::Object) {
+        NativeAccessor<T> accessor(ctx, collection);
+        for (size_t i = 0; i < size; i++) {
+            values.push_back(collection.get(accessor, i));
+        }
+    }
+    else {
+        auto realm = collection.get_realm();
+        auto& object_schema = collection.get_object_schema();
+        for (size_t i = 0; i < size; i++) {
+            auto realm_object = realm::Object(realm, object_schema, collection.template get<Obj>(i));
+            values.push_back(RealmObjectClass<T>::serialize(ctx, realm_object, depth));
+        }
+    }
+    return Object::create_array(ctx, values);
+}
+
+template<typename T>
+template<typename U>
+typename T::Object ResultsClass<T>::create_sorted(ContextType ctx, U &collection, Arguments &args) {
+    auto keypaths = get_keypaths(ctx, args);
+
+    if (auto cached = collection.m_sort_descriptor_cache.find(keypaths)) {
+        return create_instance(ctx, collection.sort(SortDescriptor(*cached)));
+    }
+
+    // Resolve plain property-name descriptors to column keys once and cache
+    // the result; keypaths that traverse links (or sort on "self") keep the
+    // core string-resolution path.
+    bool resolvable = collection.get_type() == realm::PropertyType::Object;
+    std::vector<std::vector<ColKey>> columns;
+    std::vector<bool> ascending;
+    if (resolvable) {
+        auto& object_schema = collection.get_object_schema();
+        for (auto& keypath : keypaths) {
+            const Property* property = keypath.first.find('.') == std::string::npos
+                                     ? object_schema.property_for_name(keypath.first) : nullptr;
+            if (!property || !property->column_key) {
+                resolvable = false;
+                break;
+            }
+            columns.push_back({property->column_key});
+            ascending.push_back(keypath.second);
+        }
+    }
+    if (!resolvable) {
+        return create_instance(ctx, collection.sort(keypaths));
+    }
+
+    SortDescriptor descriptor(std::move(columns), std::move(ascending));
+    auto sorted = collection.sort(SortDescriptor(descriptor));
+    collection.m_sort_descriptor_cache.insert(std::move(keypaths), std::move(descriptor));
+    return create_instance(ctx, std::move(sorted));
+}
+
 template<typename T>
 std::vector<std::pair<std::string, bool>>
 ResultsClass<T>::get_keypaths(ContextType ctx, Arguments &args) {
@@ -220,7 +659,19 @@ ResultsClass<T>::get_keypaths(ContextType ctx, Arguments &args) {
 template<typename T>
 void ResultsClass<T>::get_length(ContextType ctx, ObjectType object, ReturnValue &return_value) {
     auto results = get_internal<T, ResultsClass<T>>(ctx, object);
-    return_value.set((uint32_t)results->size());
+    auto realm = results->get_realm();
+    // Inside a write transaction the size can change without the version
+    // advancing, so only serve the cache from a plain read transaction.
+    if (!realm || realm->is_in_transaction()) {
+        return_value.set((uint32_t)results->size());
+        return;
+    }
+    auto version = realm->read_transaction_version();
+    if (!results->m_cached_size || results->m_cached_size_version != version) {
+        results->m_cached_size = results->size();
+        results->m_cached_size_version = version;
+    }
+    return_value.set((uint32_t)*results->m_cached_size);
 }
 
 template<typename T>
@@ -244,12 +695,139 @@ void ResultsClass<T>::get_index(ContextType ctx, ObjectType object, uint32_t ind
 
 template<typename T>
 void ResultsClass<T>::description(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
-    args.validate_maximum(0);
+    args.validate_maximum(2);
     auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
     auto query = results->get_query();
     auto descriptor = results->get_descriptor_ordering();
     std::string serialized_query = query.get_description() + " " + descriptor.get_description(query.get_table());
-    return_value.set(Value::from_string(ctx, serialized_query));
+
+    if (args.count == 0) {
+        return_value.set(Value::from_string(ctx, serialized_query));
+        return;
+    }
+
+    // Row dump for debugging: appends up to `maxRows` rows into one growing
+    // buffer — amortized appends, never the quadratic concatenation that used
+    // to freeze the debugger on large collections — and elides the remainder
+    // with a count. With a sink function the buffer flushes through it in
+    // chunks instead of accumulating, so full dumps stay flat in memory.
+    size_t max_rows = size_t(Value::validated_to_number(ctx, args[0], "maxRows"));
+    bool has_sink = args.count == 2 && !Value::is_undefined(ctx, args[1]);
+    FunctionType sink{};
+    if (has_sink) {
+        sink = Value::validated_to_function(ctx, args[1], "sink");
+    }
+
+    constexpr size_t chunk_size = 64 * 1024;
+    std::string buffer;
+    buffer.reserve(4096);
+    auto flush = [&] {
+        ValueType chunk_arguments[1] = {Value::from_string(ctx, buffer)};
+        Function<T>::callback(ctx, sink, this_object, 1, chunk_arguments);
+        buffer.clear();
+    };
+
+    buffer += serialized_query;
+
+    size_t size = results->size();
+    size_t limit = has_sink ? size : std::min(size, max_rows);
+    if (results->get_type() == realm::PropertyType::Object && limit > 0) {
+        auto& object_schema = results->get_object_schema();
+        std::ostringstream row;
+        for (size_t i = 0; i < limit; i++) {
+            row.str({});
+            row << '\n' << object_schema.name << '{';
+            bool first = true;
+            for (auto& prop : object_schema.persisted_properties) {
+                row << (first ? "" : ", ") << prop.name << ": ";
+                first = false;
+                if (realm::is_array(prop.type) || realm::is_set(prop.type) || realm::is_dictionary(prop.type)) {
+                    row << "<collection>";
+                }
+                else {
+                    row << results->template get<Obj>(i).get_any(prop.column_key);
+                }
+            }
+            row << '}';
+            buffer += row.str();
+            if (has_sink && buffer.size() >= chunk_size) {
+                flush();
+            }
+        }
+    }
+    if (size > limit) {
+        buffer += util::format("\n... %1 more", size - limit);
+    }
+
+    if (has_sink) {
+        if (!buffer.empty()) {
+            flush();
+        }
+        return_value.set_undefined();
+        return;
+    }
+    return_value.set(Value::from_string(ctx, buffer));
+}
+
+template<typename T>
+void ResultsClass<T>::cursor(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    return_value.set(CursorClass<T>::create_instance(ctx, *results));
+}
+
+template<typename T>
+void ResultsClass<T>::slice(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    return_value.set(create_slice(ctx, *results, args));
+}
+
+// Pagination window for infinite-scroll lists. Returns the rows in
+// [start, start + length) like slice, but additionally pins the returned
+// array on the Results object, keeping exactly the windowed rows' wrappers
+// alive in the identity map. The next window() call replaces the pin, so
+// wrappers outside the new window become collectable again - bounding live
+// wrapper count to the window size rather than every row ever touched.
+template<typename T>
+void ResultsClass<T>::window(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(2);
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+
+    size_t size = results->size();
+    size_t start = 0;
+    if (args.count > 0 && !Value::is_undefined(ctx, args[0])) {
+        double value = Value::validated_to_number(ctx, args[0], "start");
+        if (value < 0) {
+            throw std::out_of_range("'start' must not be negative.");
+        }
+        start = std::min(size, size_t(value));
+    }
+    size_t end = size;
+    if (args.count > 1 && !Value::is_undefined(ctx, args[1])) {
+        double value = Value::validated_to_number(ctx, args[1], "length");
+        if (value < 0) {
+            throw std::out_of_range("'length' must not be negative.");
+        }
+        end = std::min(size, start + size_t(value));
+    }
+
+    std::vector<ValueType> values;
+    values.reserve(end - start);
+    NativeAccessor<T> accessor(ctx, *results);
+    for (size_t i = start; i < end; i++) {
+        values.push_back(results->get(accessor, i));
+    }
+    auto window = Object::create_array(ctx, values);
+
+    static const String pinned_window = "_pinnedWindow";
+    Object::set_property(ctx, this_object, pinned_window, window, PropertyAttributes(DontEnum));
+    return_value.set(window);
+}
+
+template<typename T>
+void ResultsClass<T>::to_json(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    return_value.set(create_json(ctx, *results, args));
 }
 
 template<typename T>
@@ -265,10 +843,177 @@ void ResultsClass<T>::filtered(ContextType ctx, ObjectType this_object, Argument
     return_value.set(create_filtered(ctx, *results, args));
 }
 
+template<typename T>
+void ResultsClass<T>::filtered_async(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    validate_argument_count_at_least(args.count, 2, "filteredAsync requires a query string and a callback");
+
+    auto callback = Value::validated_to_function(ctx, args[args.count - 1], "callback");
+    Protected<FunctionType> protected_callback(ctx, callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+
+    // Building the Query is cheap and needs the JS context for argument
+    // unboxing, so it stays on this thread; only evaluation moves off it.
+    Arguments query_args{ctx, args.count - 1, args.value};
+    auto filtered_object = create_filtered(ctx, *results, query_args);
+    realm::Results filtered = *get_internal<T, ResultsClass<T>>(ctx, filtered_object);
+
+    SharedRealm realm = filtered.get_realm();
+    // Pin the current version by freezing; the frozen view may be read from
+    // any thread. Reopening from realm->config() would hand the worker this
+    // thread's scheduler (and, via the cache, possibly this thread's live
+    // instance), so every access there would fail core's thread check.
+    SharedRealm frozen_realm = realm->freeze();
+    realm::Results frozen = filtered.freeze(frozen_realm);
+
+    using FilteredCallbackHandler = void(ThreadSafeReference&& results, std::exception_ptr error);
+    realm::util::EventLoopDispatcher<FilteredCallbackHandler> callback_handler(
+            [=](ThreadSafeReference&& results_ref, std::exception_ptr error) {
+        HANDLESCOPE(protected_ctx)
+
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            } catch (const std::exception& e) {
+                ObjectType object = Object::create_empty(protected_ctx);
+                Object::set_property(protected_ctx, object, "message", Value::from_string(protected_ctx, e.what()));
+
+                ValueType callback_arguments[2] = {
+                    Value::from_undefined(protected_ctx),
+                    object,
+                };
+                Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+                return;
+            }
+        }
+
+        auto resolved = results_ref.template resolve<realm::Results>(realm);
+        ValueType callback_arguments[2] = {
+            create_instance(protected_ctx, std::move(resolved)),
+            Value::from_null(protected_ctx),
+        };
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+    });
+
+    std::thread([frozen = std::move(frozen), frozen_realm = std::move(frozen_realm),
+                 handler = std::move(callback_handler)]() mutable {
+        try {
+            // Force the query to run here against the pinned version; handing
+            // the evaluated view back lets the JS thread import it without
+            // re-running the query.
+            frozen.size();
+            handler(ThreadSafeReference(frozen), nullptr);
+        }
+        catch (...) {
+            handler(ThreadSafeReference(), std::current_exception());
+        }
+        frozen = {};
+        frozen_realm->close();
+        frozen_realm.reset();
+    }).detach();
+}
+
+template<typename T>
+void ResultsClass<T>::export_for_handover(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    return_value.set(Value::from_number(
+        ctx, static_cast<double>(HandoverRegistry::put(ThreadSafeReference(*results)))));
+}
+
+template<typename T>
+void ResultsClass<T>::sorted_async(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    validate_argument_count_at_least(args.count, 2, "sortedAsync requires a sort descriptor and a callback");
+
+    auto callback = Value::validated_to_function(ctx, args[args.count - 1], "callback");
+    Protected<FunctionType> protected_callback(ctx, callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+
+    // Resolving the descriptor needs the JS context and is cheap; only the
+    // sort itself - core materializing the ordered view - moves off-thread.
+    Arguments sort_args{ctx, args.count - 1, args.value};
+    auto sorted_object = create_sorted(ctx, *results, sort_args);
+    realm::Results sorted = *get_internal<T, ResultsClass<T>>(ctx, sorted_object);
+
+    SharedRealm realm = sorted.get_realm();
+    // As in filtered_async: freeze to pin the version rather than reopening
+    // from the live config, whose JS-thread scheduler would make every
+    // access on the worker fail core's thread check.
+    SharedRealm frozen_realm = realm->freeze();
+    realm::Results frozen = sorted.freeze(frozen_realm);
+
+    using SortedCallbackHandler = void(ThreadSafeReference&& results, std::exception_ptr error);
+    realm::util::EventLoopDispatcher<SortedCallbackHandler> callback_handler(
+            [=](ThreadSafeReference&& results_ref, std::exception_ptr error) {
+        HANDLESCOPE(protected_ctx)
+
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            } catch (const std::exception& e) {
+                ObjectType object = Object::create_empty(protected_ctx);
+                Object::set_property(protected_ctx, object, "message", Value::from_string(protected_ctx, e.what()));
+
+                ValueType callback_arguments[2] = {
+                    Value::from_undefined(protected_ctx),
+                    object,
+                };
+                Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+                return;
+            }
+        }
+
+        auto resolved = results_ref.template resolve<realm::Results>(realm);
+        ValueType callback_arguments[2] = {
+            create_instance(protected_ctx, std::move(resolved)),
+            Value::from_null(protected_ctx),
+        };
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
+    });
+
+    std::thread([frozen = std::move(frozen), frozen_realm = std::move(frozen_realm),
+                 handler = std::move(callback_handler)]() mutable {
+        try {
+            // Materialize the ordered view here at the pinned version;
+            // importing the evaluated view on the JS side skips re-sorting.
+            frozen.size();
+            handler(ThreadSafeReference(frozen), nullptr);
+        }
+        catch (...) {
+            handler(ThreadSafeReference(), std::current_exception());
+        }
+        frozen = {};
+        frozen_realm->close();
+        frozen_realm.reset();
+    }).detach();
+}
+
+template<typename T>
+void ResultsClass<T>::freeze(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    // Freezing pins the current version; the frozen wrapper never advances,
+    // never notifies, and may be read from any thread.
+    auto frozen_realm = results->get_realm()->freeze();
+    return_value.set(create_instance(ctx, results->freeze(frozen_realm)));
+}
+
+template<typename T>
+void ResultsClass<T>::get_is_frozen(ContextType ctx, ObjectType this_object, ReturnValue &return_value) {
+    return_value.set(get_internal<T, ResultsClass<T>>(ctx, this_object)->is_frozen());
+}
+
 template<typename T>
 void ResultsClass<T>::sorted(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
     auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
-    return_value.set(ResultsClass<T>::create_instance(ctx, results->sort(ResultsClass<T>::get_keypaths(ctx, args))));
+    return_value.set(create_sorted(ctx, *results, args));
 }
 
 template<typename T>
@@ -313,7 +1058,8 @@ void ResultsClass<T>::update(ContextType ctx, ObjectType this_object, Arguments
     auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
 
     auto schema = results->get_object_schema();
-    if (!schema.property_for_name(StringData(property))) {
+    const Property* prop = schema.property_for_name(StringData(property));
+    if (!prop) {
         throw std::invalid_argument(util::format("No such property: %1", property));
     }
 
@@ -322,12 +1068,16 @@ void ResultsClass<T>::update(ContextType ctx, ObjectType this_object, Arguments
         throw std::runtime_error("Can only 'update' objects within a transaction.");
     }
 
-    // TODO: This approach just moves the for-loop from JS to C++
-    // Ideally, we'd implement this in OS or Core in an optimized fashion
+    // Resolve the property and validate the value once, then write every row
+    // through a single shared accessor without materializing JS wrappers.
+    NativeAccessor<T> accessor(ctx, realm, schema);
+    if (!Value::is_valid_for_property(ctx, args[1], *prop)) {
+        throw TypeErrorException(accessor, schema.name, *prop, args[1]);
+    }
+
     for (auto i = results->size(); i > 0; i--) {
         auto realm_object = realm::Object(realm, schema, results->get(i - 1));
-        auto obj = RealmObjectClass<T>::create_instance(ctx, realm_object);
-        RealmObjectClass<T>::set_property(ctx, obj, property, args[1]);
+        realm_object.set_property_value(accessor, *prop, args[1], realm::CreatePolicy::UpdateAll);
     }
 }
 
@@ -336,6 +1086,19 @@ void ResultsClass<T>::index_of(ContextType ctx, ObjectType this_object,
                                Arguments &args, ReturnValue &return_value) {
     auto fn = [&](auto&& row) {
         auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+        // Fast path: an argument that is already a managed object resolves
+        // straight to its ObjKey, skipping accessor construction and unbox
+        // dispatch. Core validates the table and throws IncorrectTableException
+        // for mismatches, same as the generic path.
+        if (Value::is_object(ctx, row)) {
+            auto object = Value::to_object(ctx, row);
+            if (Object::template is_instance<RealmObjectClass<T>>(ctx, object)) {
+                auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, object);
+                if (realm_object && realm_object->is_valid()) {
+                    return results->index_of(realm_object->obj());
+                }
+            }
+        }
         NativeAccessor<T> accessor(ctx, *results);
         return results->index_of(accessor, row);
     };
@@ -345,9 +1108,18 @@ void ResultsClass<T>::index_of(ContextType ctx, ObjectType this_object,
 template<typename T>
 template<typename U>
 void ResultsClass<T>::add_listener(ContextType ctx, U& collection, ObjectType this_object, Arguments &args) {
-    args.validate_maximum(1);
+    args.validate_maximum(2);
 
     auto callback = Value::validated_to_function(ctx, args[0]);
+
+    // Change indexes are delivered as Uint32Arrays by default; listeners that
+    // rely on plain arrays (e.g. for mutation) can opt back in.
+    bool legacy_change_arrays = false;
+    if (args.count > 1 && !Value::is_undefined(ctx, args[1])) {
+        auto options = Value::validated_to_object(ctx, args[1], "options");
+        legacy_change_arrays = Value::to_boolean(ctx, Object::get_property(ctx, options, "legacyChangeArrays"));
+    }
+
     Protected<FunctionType> protected_callback(ctx, callback);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
@@ -356,7 +1128,7 @@ void ResultsClass<T>::add_listener(ContextType ctx, U& collection, ObjectType th
             HANDLESCOPE(protected_ctx)
             ValueType arguments[] {
                 static_cast<ObjectType>(protected_this),
-                CollectionClass<T>::create_collection_change_set(protected_ctx, change_set)
+                CollectionClass<T>::create_collection_change_set(protected_ctx, change_set, legacy_change_arrays)
             };
             Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
         });
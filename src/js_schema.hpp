@@ -44,6 +44,7 @@ struct Schema {
     static Property parse_property(ContextType, ValueType, StringData, std::string, ObjectDefaults &);
     static ObjectSchema parse_object_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &);
     static realm::Schema parse_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &);
+    static realm::Schema parse_schema_cached(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &);
 
     static ObjectType object_for_schema(ContextType, const realm::Schema &);
     static ObjectType object_for_object_schema(ContextType, const ObjectSchema &);
@@ -400,6 +401,62 @@ realm::Schema Schema<T>::parse_schema(ContextType ctx, ObjectType schema_object,
     return realm::Schema(schema);
 }
 
+// Re-parsing the same schema definition on every open walks every class and
+// property descriptor through hundreds of get_property calls. Apps that open
+// and close Realms per session pass the same definition each time, so the
+// parsed Schema plus its defaults and constructors are cached keyed on the
+// JS identity of the schema array's elements: reopening with the same
+// classes is a handful of identity comparisons. Mutating a property
+// descriptor while reusing the same class objects would defeat the keying,
+// which matches the documented requirement that schemas be immutable.
+template<typename T>
+realm::Schema Schema<T>::parse_schema_cached(ContextType ctx, ObjectType schema_object,
+                                             ObjectDefaultsMap &defaults, ConstructorMap &constructors) {
+    struct CacheEntry {
+        Protected<typename T::GlobalContext> context;
+        std::vector<Protected<ValueType>> elements;
+        realm::Schema schema;
+        ObjectDefaultsMap defaults;
+        ConstructorMap constructors;
+    };
+    // Realms are only opened from the JS thread, so no locking is needed.
+    static std::vector<CacheEntry> s_cache;
+
+    auto global_context = Context<T>::get_global_context(ctx);
+    uint32_t length = Object::validated_get_length(ctx, schema_object);
+
+    for (auto &entry : s_cache) {
+        if (static_cast<typename T::GlobalContext>(entry.context) != global_context
+                || entry.elements.size() != length) {
+            continue;
+        }
+        bool match = true;
+        for (uint32_t i = 0; i < length && match; i++) {
+            match = entry.elements[i] == Object::get_property(ctx, schema_object, i);
+        }
+        if (match) {
+            defaults = entry.defaults;
+            constructors = entry.constructors;
+            return entry.schema;
+        }
+    }
+
+    realm::Schema schema = parse_schema(ctx, schema_object, defaults, constructors);
+
+    std::vector<Protected<ValueType>> elements;
+    elements.reserve(length);
+    for (uint32_t i = 0; i < length; i++) {
+        elements.emplace_back(ctx, Object::get_property(ctx, schema_object, i));
+    }
+    s_cache.push_back(CacheEntry{Protected<typename T::GlobalContext>(global_context),
+                                 std::move(elements), schema, defaults, constructors});
+    // Keep the cache small; most apps only ever use a couple of schemas.
+    if (s_cache.size() > 8) {
+        s_cache.erase(s_cache.begin());
+    }
+    return schema;
+}
+
 template<typename T>
 typename T::Object Schema<T>::object_for_schema(ContextType ctx, const realm::Schema &schema) {
     ObjectType object = Object::create_array(ctx);
@@ -153,6 +153,12 @@ struct SetClass : ClassDefinition<T, realm::js::Set<T>, CollectionClass<T>> {
     static void filtered(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void snapshot(ContextType, ObjectType, Arguments &, ReturnValue &);
 
+    // set algebra
+    static void intersection(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void set_union(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void difference(ContextType, ObjectType, Arguments &, ReturnValue &);
+    static void is_subset_of(ContextType, ObjectType, Arguments &, ReturnValue &);
+
     // observable
     static void add_listener(ContextType, ObjectType, Arguments &, ReturnValue &);
     static void remove_listener(ContextType, ObjectType, Arguments &, ReturnValue &);
@@ -166,6 +172,10 @@ struct SetClass : ClassDefinition<T, realm::js::Set<T>, CollectionClass<T>> {
         {"delete", wrap<delete_element>},
         {"has", wrap<has>},
         {"filtered", wrap<filtered>},
+        {"intersection", wrap<intersection>},
+        {"union", wrap<set_union>},
+        {"difference", wrap<difference>},
+        {"isSubsetOf", wrap<is_subset_of>},
 
         {"min", wrap<compute_aggregate_on_collection<SetClass<T>, AggregateFunc::Min>>},
         {"max", wrap<compute_aggregate_on_collection<SetClass<T>, AggregateFunc::Max>>},
@@ -189,6 +199,7 @@ struct SetClass : ClassDefinition<T, realm::js::Set<T>, CollectionClass<T>> {
 
 private:
     static void validate_value(ContextType, realm::object_store::Set &, ValueType);
+    static realm::js::Set<T>* validated_set_argument(ContextType, const realm::object_store::Set&, ValueType);
 };
 
 template<typename T>
@@ -405,6 +416,154 @@ void SetClass<T>::filtered(ContextType ctx, ObjectType this_object, Arguments &a
 }
 
 
+/**
+ * @brief Utility function that resolves an argument to the \ref realm::js::Set it wraps
+ *
+ *  Also checks that the argument belongs to the same Realm as `set`: object
+ *  elements compare as links (table key + object key), which are only
+ *  meaningful within one Realm file, so cross-Realm algebra would produce
+ *  silently wrong results.
+ *
+ * @param ctx JS context
+ * @param set The set the argument will be combined with
+ * @param value \ref ValueType expected to wrap another Realm Set
+ * @return Pointer to the wrapped \ref realm::js::Set
+ * @exception std::invalid_argument Thrown if `value` is not a Realm Set or belongs to a different Realm
+ */
+template<typename T>
+realm::js::Set<T>* SetClass<T>::validated_set_argument(ContextType ctx, const realm::object_store::Set& set, ValueType value) {
+    if (Value::is_object(ctx, value)) {
+        auto object = Value::to_object(ctx, value);
+        if (Object::template is_instance<SetClass<T>>(ctx, object)) {
+            auto other = get_internal<T, SetClass<T>>(ctx, object);
+            if (other->get_realm() != set.get_realm()) {
+                throw std::invalid_argument("Both Sets must belong to the same Realm.");
+            }
+            return other;
+        }
+    }
+    throw std::invalid_argument("Argument must be a Realm Set.");
+}
+
+
+/**
+ * @brief Compute the intersection of this Set and another Realm Set
+ *
+ *  Walks the smaller operand and probes the larger one through core's sorted
+ *  storage, so the whole operation is a single native call rather than one
+ *  `has()` boundary crossing per element.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the SetClass itself
+ * @param args \ref Arguments structure containing another Realm Set
+ * @param return_value \ref ReturnValue wrapping an array of the common elements
+ */
+template<typename T>
+void SetClass<T>::intersection(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    auto const set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto const other = validated_set_argument(ctx, *set, args[0]);
+
+    auto const* walk = static_cast<realm::object_store::Set const*>(set);
+    auto const* probe = static_cast<realm::object_store::Set const*>(other);
+    if (walk->size() > probe->size()) {
+        std::swap(walk, probe);
+    }
+
+    auto realm = set->get_realm();
+    std::vector<ValueType> values;
+    size_t const size = walk->size();
+    for (size_t i = 0; i < size; i++) {
+        auto element = walk->get_any(i);
+        if (probe->find_any(element) != realm::not_found) {
+            values.push_back(Value::from_mixed(ctx, realm, element));
+        }
+    }
+    return_value.set(Object::create_array(ctx, values));
+}
+
+
+/**
+ * @brief Compute the union of this Set and another Realm Set
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the SetClass itself
+ * @param args \ref Arguments structure containing another Realm Set
+ * @param return_value \ref ReturnValue wrapping an array of all distinct elements of both sets
+ */
+template<typename T>
+void SetClass<T>::set_union(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    auto const set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto const other = validated_set_argument(ctx, *set, args[0]);
+
+    auto realm = set->get_realm();
+    std::vector<ValueType> values;
+    values.reserve(set->size() + other->size());
+
+    size_t const size = set->size();
+    for (size_t i = 0; i < size; i++) {
+        values.push_back(Value::from_mixed(ctx, realm, set->get_any(i)));
+    }
+    size_t const other_size = other->size();
+    for (size_t i = 0; i < other_size; i++) {
+        auto element = other->get_any(i);
+        if (set->find_any(element) == realm::not_found) {
+            values.push_back(Value::from_mixed(ctx, realm, element));
+        }
+    }
+    return_value.set(Object::create_array(ctx, values));
+}
+
+
+/**
+ * @brief Compute the difference between this Set and another Realm Set
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the SetClass itself
+ * @param args \ref Arguments structure containing another Realm Set
+ * @param return_value \ref ReturnValue wrapping an array of the elements only present in this Set
+ */
+template<typename T>
+void SetClass<T>::difference(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    auto const set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto const other = validated_set_argument(ctx, *set, args[0]);
+
+    auto realm = set->get_realm();
+    std::vector<ValueType> values;
+    size_t const size = set->size();
+    for (size_t i = 0; i < size; i++) {
+        auto element = set->get_any(i);
+        if (other->find_any(element) == realm::not_found) {
+            values.push_back(Value::from_mixed(ctx, realm, element));
+        }
+    }
+    return_value.set(Object::create_array(ctx, values));
+}
+
+
+/**
+ * @brief Check whether every element of this Set is contained in another Realm Set
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the SetClass itself
+ * @param args \ref Arguments structure containing another Realm Set
+ * @param return_value \ref ReturnValue wrapping a boolean that is true if this Set is a subset of the argument
+ */
+template<typename T>
+void SetClass<T>::is_subset_of(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    auto const set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto const other = validated_set_argument(ctx, *set, args[0]);
+    return_value.set(set->is_subset_of(*other));
+}
+
+
 /**
  * @brief Return a textual description of the value element type for the given set
  *
@@ -21,11 +21,13 @@
 #include <math.h>
 #include <cstdlib>
 
+#include "concurrent_deque.hpp"
 #include "js_class.hpp"
 #include "js_collection.hpp"
 #include "js_app.hpp"
 #include "js_user.hpp"
 #include "logger.hpp"
+#include "tracing.hpp"
 
 #include "platform.hpp"
 #include <realm/sync/config.hpp>
@@ -51,8 +53,12 @@
 extern jclass ssl_helper_class;
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <mutex>
 #include <condition_variable>
+#include <thread>
+#include <unordered_map>
 
 namespace realm {
 namespace js {
@@ -98,6 +104,69 @@ static std::string partition_value_bson_to_string(typename T::Context ctx, typen
 
 using WeakSession = std::weak_ptr<realm::SyncSession>;
 
+// Funnels sync-originated callbacks (progress, connection state) into one
+// queue drained once per event-loop iteration. A util::EventLoopDispatcher
+// posts a loop wakeup per call, so handing each delivery its own dispatcher
+// costs O(callbacks) wakeups during sync bursts; the hub posts at most one
+// wakeup per drain, i.e. O(loop ticks).
+class SyncDispatchHub {
+public:
+    // Like any EventLoopDispatcher, this must be constructed on the JS thread.
+    SyncDispatchHub()
+    : m_drain([this] { drain(); })
+    {
+    }
+
+    // Callable from any thread.
+    void post(std::function<void()>&& func)
+    {
+        m_queue.push(std::move(func));
+        if (!m_drain_pending.exchange(true)) {
+            m_drain();
+        }
+    }
+
+    // The process-wide hub, created lazily. First use must be on the JS
+    // thread, which holds as handlers are registered there.
+    static std::shared_ptr<SyncDispatchHub> shared()
+    {
+        static std::shared_ptr<SyncDispatchHub> hub = std::make_shared<SyncDispatchHub>();
+        return hub;
+    }
+
+private:
+    void drain()
+    {
+        // Clear the flag before draining so a post racing with the drain
+        // schedules a fresh wakeup instead of being stranded in the queue.
+        m_drain_pending.store(false);
+        while (auto func = m_queue.try_pop(0)) {
+            tracing::ScopedTraceEvent trace("Realm.syncCallback");
+            (*func)();
+        }
+    }
+
+    util::EventLoopDispatcher<void()> m_drain;
+    ConcurrentMPSCQueue<std::function<void()>> m_queue;
+    std::atomic<bool> m_drain_pending{false};
+};
+
+// Counters for one sync session, updated on the sync client's threads through
+// the native progress and connection-change hooks. Maintaining them costs a
+// few relaxed atomic operations per tick and never involves the JS thread
+// until a snapshot is requested through Session.stats().
+struct SessionStats {
+    std::atomic<uint64_t> uploaded_bytes{0};
+    std::atomic<uint64_t> uploadable_bytes{0};
+    std::atomic<uint64_t> downloaded_bytes{0};
+    std::atomic<uint64_t> downloadable_bytes{0};
+    std::atomic<uint64_t> upload_notifications{0};
+    std::atomic<uint64_t> download_notifications{0};
+    std::atomic<uint64_t> connects{0};
+    std::atomic<uint64_t> connection_changes{0};
+    WeakSession session;
+};
+
 template<typename T>
 class SessionClass : public ClassDefinition<T, WeakSession> {
     using ContextType = typename T::Context;
@@ -132,6 +201,7 @@ public:
     static void add_connection_notification(ContextType ctx, ObjectType this_object, Arguments &, ReturnValue &);
     static void remove_connection_notification(ContextType ctx, ObjectType this_object, Arguments &, ReturnValue &);
     static void is_connected(ContextType ctx, ObjectType this_object, Arguments &, ReturnValue &);
+    static void get_stats(ContextType ctx, ObjectType this_object, Arguments &, ReturnValue &);
     static void resume(ContextType ctx, ObjectType this_object, Arguments &, ReturnValue &);
     static void pause(ContextType ctx, ObjectType this_object, Arguments &, ReturnValue &);
 //    static void override_server(ContextType, ObjectType, Arguments &, ReturnValue &);
@@ -156,6 +226,7 @@ public:
         {"addConnectionNotification", wrap<add_connection_notification>},
         {"removeConnectionNotification", wrap<remove_connection_notification>},
         {"isConnected", wrap<is_connected>},
+        {"stats", wrap<get_stats>},
         {"resume", wrap<resume>},
         {"pause", wrap<pause>},
     };
@@ -164,6 +235,11 @@ private:
     enum Direction { Upload, Download };
     static std::string get_connection_state_value(SyncSession::ConnectionState state);
     static void wait_for_completion(Direction direction, ContextType ctx, ObjectType this_object, Arguments& args);
+
+    // Stats are shared across Session wrappers of the same underlying sync
+    // session; entries whose session has gone away are pruned lazily.
+    static inline std::mutex s_stats_mutex;
+    static inline std::unordered_map<SyncSession*, std::shared_ptr<SessionStats>> s_stats;
 };
 
 template<typename T>
@@ -230,17 +306,53 @@ public:
     {
     }
 
-    // This function is called on the sync client's event loop thread.
+    struct ChainEntry {
+        std::string pem;
+        int preverify_ok;
+        int depth;
+    };
+
+    // This function is called on the sync client's event loop thread, once per
+    // certificate in the chain with the deepest certificate first and the
+    // server's own certificate last (depth 0).
     bool operator ()(const std::string& server_address, util::network::Endpoint::port_type server_port, const char* pem_data, size_t pem_size, int preverify_ok, int depth)
     {
-        const std::string pem_certificate {pem_data, pem_size};
+        // Collect the chain and defer judgement until depth 0 so the whole
+        // chain crosses to the node.js thread in a single dispatch instead of
+        // one blocking round trip per certificate. A rejected certificate
+        // still fails the handshake; it is just reported at depth 0.
+        m_pending_chain.push_back({{pem_data, pem_size}, preverify_ok, depth});
+        if (depth > 0) {
+            return true;
+        }
+
+        std::vector<ChainEntry> chain;
+        chain.swap(m_pending_chain);
+
+        // Reconnects - frequent on mobile networks - present the same chain
+        // again, so serve repeat verifications from a short-lived verdict
+        // cache instead of blocking the sync thread on the JS round trip.
+        std::string cache_key = server_address + ':' + std::to_string(server_port);
+        for (auto& entry : chain) {
+            cache_key += '\n';
+            cache_key += entry.pem;
+        }
+        auto now = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(s_verdict_cache_mutex);
+            auto it = s_verdict_cache.find(cache_key);
+            if (it != s_verdict_cache.end() && now - it->second.second < s_verdict_ttl) {
+                return it->second.first;
+            }
+        }
+
         {
             std::lock_guard<std::mutex> lock {*m_mutex};
             m_ssl_certificate_callback_done = false;
         }
 
         // Dispatch the call to the main_loop_handler on the node.js thread.
-        m_event_loop_dispatcher(this, server_address, server_port, pem_certificate, preverify_ok, depth);
+        m_event_loop_dispatcher(this, server_address, server_port, chain);
 
         bool ssl_certificate_accepted = false;
         {
@@ -251,39 +363,58 @@ public:
             ssl_certificate_accepted = m_ssl_certificate_accepted;
         }
 
+        {
+            std::lock_guard<std::mutex> lock(s_verdict_cache_mutex);
+            // Drop expired entries so the cache stays bounded by live endpoints.
+            for (auto it = s_verdict_cache.begin(); it != s_verdict_cache.end();) {
+                if (now - it->second.second >= s_verdict_ttl) {
+                    it = s_verdict_cache.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            s_verdict_cache[cache_key] = {ssl_certificate_accepted, now};
+        }
+
         return ssl_certificate_accepted;
     }
 
     // main_loop_handler is called on the node.js main thread.
-    // main_loop_handler calls the user callback (m_func) and sends the return value
-    // back to the sync client's event loop thread through a condition variable.
+    // main_loop_handler calls the user callback (m_func) once per certificate
+    // in the chain - the same objects the per-depth dispatches used to carry -
+    // and sends the combined verdict back to the sync client's event loop
+    // thread through a condition variable.
     static void main_loop_handler(SSLVerifyCallbackSyncThreadFunctor<T>* this_object,
                                   const std::string& server_address,
                                   util::network::Endpoint::port_type server_port,
-                                  const std::string& pem_certificate,
-                                  int preverify_ok,
-                                  int depth)
+                                  const std::vector<ChainEntry>& chain)
     {
         const Protected<typename T::GlobalContext>& ctx = this_object->m_ctx;
 		HANDLESCOPE(ctx)
 
-
-        typename T::Object ssl_certificate_object = Object<T>::create_empty(ctx);
-        Object<T>::set_property(ctx, ssl_certificate_object, "serverAddress", Value<T>::from_string(ctx, server_address));
-        Object<T>::set_property(ctx, ssl_certificate_object, "serverPort", Value<T>::from_number(ctx, double(server_port)));
-        Object<T>::set_property(ctx, ssl_certificate_object, "pemCertificate", Value<T>::from_string(ctx, pem_certificate));
-        Object<T>::set_property(ctx, ssl_certificate_object, "acceptedByOpenSSL", Value<T>::from_boolean(ctx, preverify_ok != 0));
-        Object<T>::set_property(ctx, ssl_certificate_object, "depth", Value<T>::from_number(ctx, double(depth)));
-
-        const int argc = 1;
-        typename T::Value arguments[argc] = { ssl_certificate_object };
-        typename T::Value ret_val = Function<T>::callback(ctx, this_object->m_func, 1, arguments);
-        bool ret_val_bool = Value<T>::to_boolean(ctx, ret_val);
+        bool accepted = true;
+        for (auto& entry : chain) {
+            typename T::Object ssl_certificate_object = Object<T>::create_empty(ctx);
+            Object<T>::set_property(ctx, ssl_certificate_object, "serverAddress", Value<T>::from_string(ctx, server_address));
+            Object<T>::set_property(ctx, ssl_certificate_object, "serverPort", Value<T>::from_number(ctx, double(server_port)));
+            Object<T>::set_property(ctx, ssl_certificate_object, "pemCertificate", Value<T>::from_string(ctx, entry.pem));
+            Object<T>::set_property(ctx, ssl_certificate_object, "acceptedByOpenSSL", Value<T>::from_boolean(ctx, entry.preverify_ok != 0));
+            Object<T>::set_property(ctx, ssl_certificate_object, "depth", Value<T>::from_number(ctx, double(entry.depth)));
+
+            const int argc = 1;
+            typename T::Value arguments[argc] = { ssl_certificate_object };
+            typename T::Value ret_val = Function<T>::callback(ctx, this_object->m_func, 1, arguments);
+            if (!Value<T>::to_boolean(ctx, ret_val)) {
+                accepted = false;
+                break;
+            }
+        }
 
         {
             std::lock_guard<std::mutex> lock {*this_object->m_mutex};
             this_object->m_ssl_certificate_callback_done = true;
-            this_object->m_ssl_certificate_accepted = ret_val_bool;
+            this_object->m_ssl_certificate_accepted = accepted;
         }
 
         this_object->m_cond_var->notify_one();
@@ -296,13 +427,19 @@ private:
     util::EventLoopDispatcher<void(SSLVerifyCallbackSyncThreadFunctor<T>* this_object,
                                    const std::string& server_address,
                                    util::network::Endpoint::port_type server_port,
-                                   const std::string& pem_certificate,
-                                   int preverify_ok,
-                                   int depth)> m_event_loop_dispatcher;
+                                   const std::vector<ChainEntry>& chain)> m_event_loop_dispatcher;
     bool m_ssl_certificate_callback_done = false;
     bool m_ssl_certificate_accepted = false;
     std::shared_ptr<std::mutex> m_mutex;
     std::shared_ptr<std::condition_variable> m_cond_var;
+    // Only touched on the sync client's event loop thread.
+    std::vector<ChainEntry> m_pending_chain;
+
+    // Verdicts keyed by server address, port and the full PEM chain (which is
+    // collision-free, unlike a digest), shared across sessions.
+    static constexpr std::chrono::minutes s_verdict_ttl{5};
+    static inline std::mutex s_verdict_cache_mutex;
+    static inline std::unordered_map<std::string, std::pair<bool, std::chrono::steady_clock::time_point>> s_verdict_cache;
 };
 
 // TODO: We should move this function to js_user.hpp but hard due to circular dependency
@@ -408,7 +545,7 @@ void SessionClass<T>::simulate_error(ContextType ctx, ObjectType this_object, Ar
 
 template<typename T>
 void SessionClass<T>::add_progress_notification(ContextType ctx, ObjectType this_object, Arguments &args, ReturnValue &return_value) {
-    args.validate_count(3);
+    args.validate_between(3, 4);
 
     if (auto session = get_internal<T, SessionClass<T>>(ctx, this_object)->lock()) {
 
@@ -438,12 +575,20 @@ void SessionClass<T>::add_progress_notification(ContextType ctx, ObjectType this
 
         auto callback_function = Value::validated_to_function(ctx, args[2], "callback");
 
+        // Optional coalescing interval in milliseconds: deliver at most one
+        // callback per interval, carrying the latest (transferred,
+        // transferrable) pair. 0 (the default) reports every progress tick.
+        uint64_t throttle_ms = 0;
+        if (args.count == 4 && !Value::is_undefined(ctx, args[3])) {
+            throttle_ms = static_cast<uint64_t>(Value::validated_to_number(ctx, args[3], "throttleMs"));
+        }
+
         Protected<FunctionType> protected_callback(ctx, callback_function);
         Protected<ObjectType> protected_this(ctx, this_object);
         Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
         std::function<ProgressHandler> progressFunc;
 
-        util::EventLoopDispatcher<ProgressHandler> progress_handler([=](uint64_t transferred_bytes, uint64_t transferrable_bytes) {
+        auto js_handler = std::make_shared<std::function<ProgressHandler>>([=](uint64_t transferred_bytes, uint64_t transferrable_bytes) {
             HANDLESCOPE(protected_ctx)
             ValueType callback_arguments[2] = {
                 Value::from_number(protected_ctx, transferred_bytes),
@@ -453,7 +598,72 @@ void SessionClass<T>::add_progress_notification(ContextType ctx, ObjectType this
             Function<T>::callback(protected_ctx, protected_callback, 2, callback_arguments);
         });
 
-        progressFunc = std::move(progress_handler);
+        // Deliveries go through the shared dispatch hub, which coalesces
+        // event-loop wakeups across all sync-originated callbacks.
+        auto hub = SyncDispatchHub::shared();
+        auto progress_handler = [hub, js_handler](uint64_t transferred_bytes, uint64_t transferrable_bytes) {
+            hub->post([js_handler, transferred_bytes, transferrable_bytes] {
+                (*js_handler)(transferred_bytes, transferrable_bytes);
+            });
+        };
+
+        if (throttle_ms > 0) {
+            // Coalesce on the sync client thread: each tick only records the
+            // latest pair, and at most one delivery per interval is queued to
+            // the JS thread. During a large initial sync this collapses
+            // thousands of dispatches (each with its own handle scope) per
+            // second into a handful.
+            struct CoalescedProgress {
+                std::mutex mutex;
+                uint64_t transferred = 0;
+                uint64_t transferrable = 0;
+                bool delivery_scheduled = false;
+                std::chrono::steady_clock::time_point last_delivery;
+            };
+            auto state = std::make_shared<CoalescedProgress>();
+            auto interval = std::chrono::milliseconds(throttle_ms);
+
+            auto deliver = [state, progress_handler] {
+                uint64_t transferred, transferrable;
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    transferred = state->transferred;
+                    transferrable = state->transferrable;
+                    state->delivery_scheduled = false;
+                    state->last_delivery = std::chrono::steady_clock::now();
+                }
+                progress_handler(transferred, transferrable);
+            };
+
+            progressFunc = [state, interval, deliver = std::move(deliver)](uint64_t transferred, uint64_t transferrable) {
+                std::unique_lock<std::mutex> lock(state->mutex);
+                state->transferred = transferred;
+                state->transferrable = transferrable;
+                if (state->delivery_scheduled) {
+                    // An in-flight delivery will pick up these values.
+                    return;
+                }
+                state->delivery_scheduled = true;
+                auto remaining = state->last_delivery + interval - std::chrono::steady_clock::now();
+                lock.unlock();
+
+                if (remaining <= std::chrono::steady_clock::duration::zero()) {
+                    deliver();
+                }
+                else {
+                    // Trailing-edge delivery so the final pair of a burst is
+                    // never dropped. The shared_ptr captures keep the state
+                    // and dispatcher alive until the timer fires.
+                    std::thread([remaining, deliver] {
+                        std::this_thread::sleep_for(remaining);
+                        deliver();
+                    }).detach();
+                }
+            };
+        }
+        else {
+            progressFunc = std::move(progress_handler);
+        }
 
         auto registrationToken = session->register_progress_notifier(std::move(progressFunc), direction, is_streaming);
         auto syncSession = create_object<T, SessionClass<T>>(ctx, new WeakSession(session));
@@ -492,7 +702,7 @@ void SessionClass<T>::add_connection_notification(ContextType ctx, ObjectType th
 
         std::function<ConnectionHandler> connectionFunc;
 
-        util::EventLoopDispatcher<ConnectionHandler> connection_handler([=](SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state) {
+        auto js_handler = std::make_shared<std::function<ConnectionHandler>>([=](SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state) {
             HANDLESCOPE(protected_ctx)
             ValueType callback_arguments[2] = {
                 Value::from_string(protected_ctx, get_connection_state_value(new_state)),
@@ -501,7 +711,14 @@ void SessionClass<T>::add_connection_notification(ContextType ctx, ObjectType th
             Function<T>::callback(protected_ctx, protected_callback, 2, callback_arguments);
         });
 
-        connectionFunc = std::move(connection_handler);
+        // Delivered through the shared dispatch hub so connection flaps during
+        // sync bursts share loop wakeups with the progress callbacks.
+        auto hub = SyncDispatchHub::shared();
+        connectionFunc = [hub, js_handler](SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state) {
+            hub->post([js_handler, old_state, new_state] {
+                (*js_handler)(old_state, new_state);
+            });
+        };
 
         auto notificationToken = session->register_connection_change_callback(std::move(connectionFunc));
         auto syncSession = create_object<T, SessionClass<T>>(ctx, new WeakSession(session));
@@ -542,6 +759,74 @@ void SessionClass<T>::is_connected(ContextType ctx, ObjectType this_object, Argu
     }
 }
 
+template<typename T>
+void SessionClass<T>::get_stats(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue &return_value) {
+    args.validate_count(0);
+
+    auto session = get_internal<T, SessionClass<T>>(ctx, this_object)->lock();
+    if (!session) {
+        return_value.set_undefined();
+        return;
+    }
+
+    std::shared_ptr<SessionStats> stats;
+    {
+        std::lock_guard<std::mutex> lock(s_stats_mutex);
+        for (auto it = s_stats.begin(); it != s_stats.end();) {
+            if (it->second->session.expired()) {
+                it = s_stats.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        auto it = s_stats.find(session.get());
+        if (it != s_stats.end()) {
+            stats = it->second;
+        }
+    }
+
+    if (!stats) {
+        // First stats() call for this session: hook the native progress and
+        // connection-change notifiers. They run on the sync client's threads,
+        // so the counters accumulate from here on with no JS involvement.
+        stats = std::make_shared<SessionStats>();
+        stats->session = session;
+        session->register_progress_notifier([stats](uint64_t transferred, uint64_t transferrable) {
+            stats->uploaded_bytes.store(transferred, std::memory_order_relaxed);
+            stats->uploadable_bytes.store(transferrable, std::memory_order_relaxed);
+            stats->upload_notifications.fetch_add(1, std::memory_order_relaxed);
+        }, SyncSession::ProgressDirection::upload, true);
+        session->register_progress_notifier([stats](uint64_t transferred, uint64_t transferrable) {
+            stats->downloaded_bytes.store(transferred, std::memory_order_relaxed);
+            stats->downloadable_bytes.store(transferrable, std::memory_order_relaxed);
+            stats->download_notifications.fetch_add(1, std::memory_order_relaxed);
+        }, SyncSession::ProgressDirection::download, true);
+        session->register_connection_change_callback([stats](SyncSession::ConnectionState, SyncSession::ConnectionState new_state) {
+            stats->connection_changes.fetch_add(1, std::memory_order_relaxed);
+            if (new_state == SyncSession::ConnectionState::Connected) {
+                stats->connects.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        std::lock_guard<std::mutex> lock(s_stats_mutex);
+        s_stats.emplace(session.get(), stats);
+    }
+
+    uint64_t connects = stats->connects.load(std::memory_order_relaxed);
+    return_value.set(Object::create_obj(ctx, {
+        {"uploadedBytes", Value::from_number(ctx, double(stats->uploaded_bytes.load(std::memory_order_relaxed)))},
+        {"uploadableBytes", Value::from_number(ctx, double(stats->uploadable_bytes.load(std::memory_order_relaxed)))},
+        {"downloadedBytes", Value::from_number(ctx, double(stats->downloaded_bytes.load(std::memory_order_relaxed)))},
+        {"downloadableBytes", Value::from_number(ctx, double(stats->downloadable_bytes.load(std::memory_order_relaxed)))},
+        {"uploadProgressNotifications", Value::from_number(ctx, double(stats->upload_notifications.load(std::memory_order_relaxed)))},
+        {"downloadProgressNotifications", Value::from_number(ctx, double(stats->download_notifications.load(std::memory_order_relaxed)))},
+        {"connects", Value::from_number(ctx, double(connects))},
+        {"reconnects", Value::from_number(ctx, double(connects > 0 ? connects - 1 : 0))},
+        {"connectionChanges", Value::from_number(ctx, double(stats->connection_changes.load(std::memory_order_relaxed)))},
+    }));
+}
+
 template<typename T>
 void SessionClass<T>::resume(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue &return_value) {
     args.validate_count(0);
@@ -162,9 +162,21 @@ struct Value {
     static bool is_valid_for_property(ContextType, const ValueType&, const Property&);
     static bool is_valid_for_property_type(ContextType, const ValueType&, realm::PropertyType type, StringData object_type);
 
+    // Resolves the type switch in is_valid_for_property to a direct function
+    // pointer, so callers validating many values against the same property
+    // (see RealmDelegate::property_validators) dispatch without rediscovering
+    // the type each time.
+    using PropertyValidator = bool (*)(ContextType, const ValueType&, const Property&);
+    static PropertyValidator validator_for_property(const Property&);
+
     static ValueType from_boolean(ContextType, bool);
     static ValueType from_null(ContextType);
     static ValueType from_number(ContextType, double);
+    // Integer-specialized boxing/unboxing for int64 columns. Engines with a
+    // native integer path (N-API) avoid the double round-trip; others fall
+    // back to the number conversions.
+    static ValueType from_integer(ContextType, int64_t);
+    static int64_t to_integer(ContextType, const ValueType&);
     static ValueType from_decimal128(ContextType, const Decimal128&);
     static ValueType from_object_id(ContextType, const ObjectId&);
     static ValueType from_string(ContextType ctx, const char *s) { return s ? from_nonnull_string(ctx, s) : from_null(ctx); }
@@ -173,6 +185,10 @@ struct Value {
     static ValueType from_binary(ContextType ctx, BinaryData b) { return b ? from_nonnull_binary(ctx, b) : from_null(ctx); }
     static ValueType from_nonnull_string(ContextType, const String<T>&);
     static ValueType from_nonnull_binary(ContextType, BinaryData);
+    // Moves `data` into an ArrayBuffer. Engines with externally-backed buffer
+    // support adopt the bytes without copying and free them when the buffer is
+    // collected; otherwise this falls back to a copying conversion.
+    static ValueType from_external_binary(ContextType, std::string&& data);
     static ValueType from_undefined(ContextType);
     static ValueType from_timestamp(ContextType, Timestamp);
     static ValueType from_uuid(ContextType, const UUID&);
@@ -194,8 +210,17 @@ struct Value {
     static ObjectType to_object(ContextType, const ValueType &);
     static String<T> to_string(ContextType, const ValueType &);
     static OwnedBinaryData to_binary(ContextType, const ValueType&);
+    // Non-owning view of the bytes backing a Buffer/ArrayBuffer/ArrayBufferView,
+    // or a null view when the engine cannot expose a stable pointer. The view is
+    // only valid while the JS value stays alive and no JS code runs, so callers
+    // must consume it synchronously (e.g. core copying it into a column).
+    static BinaryData to_binary_view(ContextType, const ValueType&);
     static bson::Bson to_bson(ContextType, ValueType);
     static Mixed to_mixed(ContextType ctx, std::shared_ptr<Realm> realm, const ValueType& value, std::string &string_buffer);
+    // Hinted variant for batch paths: tries the converter that matched the
+    // previous value before falling back to the full dispatch chain, and
+    // updates the hint with the type that was produced.
+    static Mixed to_mixed(ContextType ctx, std::shared_ptr<Realm> realm, const ValueType& value, std::string &string_buffer, DataType::Type& last_type);
 
 #define VALIDATED(return_t, type) \
     static return_t validated_to_##type(ContextType ctx, const ValueType &value, const char *name = nullptr) { \
@@ -294,6 +319,9 @@ struct Object {
     static ValueType get_property(ContextType c, const ObjectType &o, const std::string &s) { return get_property(c, o, StringData(s)); }
     static ValueType get_property(ContextType, const ObjectType &, const String<T> &);
     static ValueType get_property(ContextType, const ObjectType &, uint32_t);
+    // Key is an already-created JS string (see RealmDelegate::property_keys);
+    // skips re-encoding the UTF-8 property name on every access.
+    static ValueType get_property(ContextType, const ObjectType &, const ValueType &key);
     static void set_property(ContextType ctx, ObjectType&& obj, const String<T>& field, const ValueType& val, PropertyAttributes attributes = None) {
         set_property(ctx, obj, field, val, attributes);
     }
@@ -302,6 +330,10 @@ struct Object {
     }
     static void set_property(ContextType, ObjectType &, const String<T> &, const ValueType &, PropertyAttributes attributes = None);
     static void set_property(ContextType, ObjectType &, uint32_t, const ValueType &);
+    // Defines `field` as a lazily-initialized property: `factory` runs on the
+    // first read and the produced value replaces the accessor. Engines without
+    // a native define-accessor API call the factory eagerly instead.
+    static void set_lazy_property(ContextType, const ObjectType &, const String<T> &, ValueType (*factory)(ContextType));
     static std::vector<String<T>> get_property_names(ContextType, const ObjectType &);
 
     static void set_global(ContextType, const String<T> &, const ValueType &);
@@ -321,22 +353,34 @@ struct Object {
         return Value<T>::validated_to_number(ctx, get_property(ctx, object, length_string));
     }
 
+// The key is only stringified on the throw path: validation overwhelmingly
+// succeeds, and converting the key per call (a UTF-16 transcode on
+// JavaScriptCore) showed up in allocation profiles.
 #define VALIDATED(return_t, type) \
     static return_t validated_get_##type(ContextType ctx, const ObjectType &object, const String<T> &key, const char *message = nullptr) { \
-        try { \
-            return Value<T>::validated_to_##type(ctx, get_property(ctx, object, key), std::string(key).c_str()); \
-        } \
-        catch (std::invalid_argument &e) { \
-            throw message ? std::invalid_argument(util::format("Failed to read %1: %2", message, e.what())) : e; \
+        auto value = get_property(ctx, object, key); \
+        if (!Value<T>::is_##type(ctx, value)) { \
+            std::string key_text = key; \
+            try { \
+                Value<T>::validated_to_##type(ctx, value, key_text.c_str()); \
+            } \
+            catch (std::invalid_argument &e) { \
+                throw message ? std::invalid_argument(util::format("Failed to read %1: %2", message, e.what())) : e; \
+            } \
         } \
+        return Value<T>::to_##type(ctx, value); \
     } \
     static return_t validated_get_##type(ContextType ctx, const ObjectType &object, uint32_t index, const char *message = nullptr) { \
-        try { \
-            return Value<T>::validated_to_##type(ctx, get_property(ctx, object, index)); \
-        } \
-        catch (std::invalid_argument &e) { \
-            throw message ? std::invalid_argument(util::format("Failed to read %1: %2", message, e.what())) : e; \
+        auto value = get_property(ctx, object, index); \
+        if (!Value<T>::is_##type(ctx, value)) { \
+            try { \
+                Value<T>::validated_to_##type(ctx, value); \
+            } \
+            catch (std::invalid_argument &e) { \
+                throw message ? std::invalid_argument(util::format("Failed to read %1: %2", message, e.what())) : e; \
+            } \
         } \
+        return Value<T>::to_##type(ctx, value); \
     }
 
     VALIDATED(ObjectType, array)
@@ -373,6 +417,10 @@ struct Object {
         return obj;
     }
 
+    // Batch construction: the whole element buffer is handed to the engine in
+    // one call (JSObjectMakeArray on JSC, a length-presized array filled with
+    // raw element writes on N-API). Prefer building a vector and calling this
+    // over growing an array element-by-element through set_property.
     static ObjectType create_array(ContextType, uint32_t, const ValueType[]);
     static ObjectType create_array(ContextType ctx, const std::vector<ValueType> &values) {
         return create_array(ctx, (uint32_t)values.size(), values.data());
@@ -430,6 +478,17 @@ Protected(GlobalCtx) -> Protected<GlobalCtx>;
 template <typename Ctx, typename T>
 Protected(Ctx, T) -> Protected<T>;
 
+// Weak counterpart to Protected: holds a JS object without keeping it alive
+// and reads back empty once the engine collects it. Engines without a
+// weak-value API provide a stub that is always empty, so callers must be
+// prepared to fall back to creating a fresh object.
+template<typename ObjectType>
+class WeakObjectReference {
+  public:
+    explicit operator bool() const;
+    ObjectType get() const;
+};
+
 
 template<typename T>
 struct Exception : public std::runtime_error {
@@ -504,6 +563,62 @@ inline bool Value<T>::is_valid_for_property(ContextType context, const ValueType
     return is_valid_for_property_type(context, value, prop.type, prop.object_type);
 }
 
+template<typename T>
+inline typename Value<T>::PropertyValidator Value<T>::validator_for_property(const Property& prop) {
+    using realm::PropertyType;
+
+    // Collections and scalar types without a single cheap check keep the
+    // generic path; everything else binds the null handling plus one type
+    // predicate and never switches again.
+    if (realm::is_array(prop.type) || realm::is_set(prop.type) || realm::is_dictionary(prop.type)) {
+        return &is_valid_for_property;
+    }
+
+    switch (prop.type & ~PropertyType::Flags) {
+        case PropertyType::Int:
+        case PropertyType::Float:
+        case PropertyType::Double:
+            return [](ContextType ctx, const ValueType& value, const Property& p) {
+                return (is_nullable(p.type) && (is_null(ctx, value) || is_undefined(ctx, value))) || is_number(ctx, value);
+            };
+        case PropertyType::Decimal:
+            return [](ContextType ctx, const ValueType& value, const Property& p) {
+                return (is_nullable(p.type) && (is_null(ctx, value) || is_undefined(ctx, value))) || is_decimal128(ctx, value);
+            };
+        case PropertyType::ObjectId:
+            return [](ContextType ctx, const ValueType& value, const Property& p) {
+                return (is_nullable(p.type) && (is_null(ctx, value) || is_undefined(ctx, value))) || is_object_id(ctx, value);
+            };
+        case PropertyType::Bool:
+            return [](ContextType ctx, const ValueType& value, const Property& p) {
+                return (is_nullable(p.type) && (is_null(ctx, value) || is_undefined(ctx, value))) || is_boolean(ctx, value);
+            };
+        case PropertyType::String:
+            return [](ContextType ctx, const ValueType& value, const Property& p) {
+                return (is_nullable(p.type) && (is_null(ctx, value) || is_undefined(ctx, value))) || is_string(ctx, value);
+            };
+        case PropertyType::Data:
+            return [](ContextType ctx, const ValueType& value, const Property& p) {
+                return (is_nullable(p.type) && (is_null(ctx, value) || is_undefined(ctx, value)))
+                    || is_binary(ctx, value) || is_string(ctx, value);
+            };
+        case PropertyType::Date:
+            return [](ContextType ctx, const ValueType& value, const Property& p) {
+                return (is_nullable(p.type) && (is_null(ctx, value) || is_undefined(ctx, value)))
+                    || is_date(ctx, value) || is_string(ctx, value);
+            };
+        case PropertyType::UUID:
+            return [](ContextType ctx, const ValueType& value, const Property& p) {
+                return (is_nullable(p.type) && (is_null(ctx, value) || is_undefined(ctx, value))) || is_uuid(ctx, value);
+            };
+        case PropertyType::Object:
+        case PropertyType::Mixed:
+            return [](ContextType, const ValueType&, const Property&) { return true; };
+        default:
+            return &is_valid_for_property;
+    }
+}
+
 template<typename T>
 inline bool Value<T>::is_valid_for_property_type(ContextType context, const ValueType &value, realm::PropertyType type, StringData object_type) {
     using realm::PropertyType;
@@ -729,7 +844,7 @@ typename T::Value Value<T>::from_mixed(ContextType ctx, std::shared_ptr<Realm> r
     }
 
     switch (mixed.get_type()) {
-        case DataType::Type::Int: return from_number(ctx, mixed.get_int());
+        case DataType::Type::Int: return from_integer(ctx, mixed.get_int());
         case DataType::Type::Bool: return from_boolean(ctx, mixed.get_bool());
         case DataType::Type::String: {
             auto str = std::string(mixed.get<StringData>());
@@ -796,7 +911,16 @@ typename realm::Mixed Value<T>::to_mixed(ContextType ctx, std::shared_ptr<Realm>
         return Mixed(string_buffer);
     }
     else if (is_binary(ctx, value)) {
-        return Mixed(to_binary(ctx, value).get());
+        // Borrow the JS buffer's bytes directly when the engine can expose a
+        // stable pointer; core copies them into the file before control
+        // returns to JS. The fallback stages the copy in the caller's buffer
+        // so the bytes outlive this call.
+        if (BinaryData view = to_binary_view(ctx, value)) {
+            return Mixed(view);
+        }
+        OwnedBinaryData owned = to_binary(ctx, value);
+        string_buffer.assign(owned.get().data(), owned.get().size());
+        return Mixed(BinaryData(string_buffer.data(), string_buffer.size()));
     }
     else if (is_decimal128(ctx, value)) {
         return Mixed(to_decimal128(ctx, value));
@@ -828,6 +952,42 @@ typename realm::Mixed Value<T>::to_mixed(ContextType ctx, std::shared_ptr<Realm>
     REALM_UNREACHABLE();
 }
 
+template<typename T>
+typename realm::Mixed Value<T>::to_mixed(ContextType ctx, std::shared_ptr<Realm> realm, const ValueType& value, std::string& string_buffer, DataType::Type& last_type) {
+    // Mixed columns overwhelmingly hold long runs of one type, so probe the
+    // predicate that matched the previous value before walking the full
+    // is_*() chain. Only the common scalar types are memoized; anything else
+    // (dates, blobs, links, ...) falls through to the full dispatch, which
+    // keeps its original check order and error reporting.
+    if (!is_null(ctx, value) && !is_undefined(ctx, value)) {
+        switch (last_type) {
+            case DataType::Type::String:
+                if (is_string(ctx, value)) {
+                    string_buffer = std::move(to_string(ctx, value));
+                    return Mixed(string_buffer);
+                }
+                break;
+            case DataType::Type::Double:
+                if (is_number(ctx, value)) {
+                    return Mixed(to_number(ctx, value));
+                }
+                break;
+            case DataType::Type::Bool:
+                if (is_boolean(ctx, value)) {
+                    return Mixed(to_boolean(ctx, value));
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    Mixed mixed = to_mixed(ctx, realm, value, string_buffer);
+    if (!mixed.is_null()) {
+        last_type = mixed.get_type();
+    }
+    return mixed;
+}
+
 template <typename T>
 auto Function<T>::wrap_void_callback(ContextType ctx, const ObjectType& this_object, const FunctionType& callback) {
     return [ctx = Protected(Context<T>::get_global_context(ctx)),
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "bson_binary.hpp"
 #include "js_class.hpp"
 #include "js_collection.hpp"
 #include "js_app_credentials.hpp"
@@ -32,6 +33,13 @@
 #include <realm/object-store/sync/app.hpp>
 #include "platform.hpp"
 
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_set>
+
 namespace realm {
 namespace js {
 
@@ -106,11 +114,99 @@ void WatchStreamClass<T>::feed_buffer(ContextType ctx, ObjectType object, Argume
 
 template<typename T>
 void WatchStreamClass<T>::next_event(ContextType ctx, ObjectType object, Arguments& args, ReturnValue &return_value) {
-    args.validate_count(0);
+    args.validate_maximum(1);
     WatchStream* ws = get_internal<T, WatchStreamClass<T>>(ctx, object);
+    // Opt-in binary path, mirroring callFunction: the change document leaves
+    // native as binary BSON in an externally-backed buffer, skipping the EJSON
+    // stringification here and the matching re-parse on the JS side.
+    if (args.count == 1 && Value::to_boolean(ctx, args[0])) {
+        return return_value.set(Value::from_external_binary(ctx, bson_binary::encode(bson::Bson(ws->next_event()))));
+    }
     return return_value.set(Value::from_string(ctx, String::from_bson(ws->next_event())));
 }
 
+// Proactively refreshes a logged-in user's access token slightly ahead of its
+// expiry, so the first request after the old token would have lapsed never
+// pays an inline auth round trip. One background thread watches each user,
+// keyed by identity, which also coalesces refreshes across wrappers and
+// sessions of the same user; the wake-up is jittered so clients that logged
+// in at the same moment don't refresh in lockstep.
+class AccessTokenRefreshScheduler {
+public:
+    static AccessTokenRefreshScheduler& shared() {
+        // Deliberately leaked: detached refresh threads may still be running
+        // during static destruction at process exit.
+        static AccessTokenRefreshScheduler* scheduler = new AccessTokenRefreshScheduler;
+        return *scheduler;
+    }
+
+    void watch(SharedApp app, SharedUser user) {
+        if (!app || !user || user->state() != SyncUser::State::LoggedIn) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_watched.insert(user->identity()).second) {
+                return; // a refresh thread is already watching this user
+            }
+        }
+        std::thread([this, app = std::move(app), user = std::move(user)] {
+            run(app, user);
+        }).detach();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::unordered_set<std::string> m_watched;
+
+    void unwatch(const std::string& identity) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_watched.erase(identity);
+    }
+
+    void run(const SharedApp& app, const SharedUser& user) {
+        constexpr int64_t refresh_lead_seconds = 120;
+        std::mt19937 jitter_generator{std::random_device{}()};
+        std::uniform_int_distribution<int64_t> jitter{0, 30};
+
+        while (user->state() == SyncUser::State::LoggedIn) {
+            int64_t expires_at = 0;
+            try {
+                expires_at = RealmJWT(user->access_token()).expires_at;
+            }
+            catch (...) {
+                break; // not a token we can read an expiry from
+            }
+            if (expires_at == 0) {
+                break;
+            }
+            auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            int64_t wait = expires_at - now - refresh_lead_seconds - jitter(jitter_generator);
+            if (wait > 0) {
+                std::this_thread::sleep_for(std::chrono::seconds(wait));
+            }
+            if (user->state() != SyncUser::State::LoggedIn) {
+                break;
+            }
+
+            // The refresh request itself goes out through the network
+            // transport like any other; only this thread blocks on it.
+            std::promise<util::Optional<app::AppError>> refreshed;
+            app->refresh_custom_data(user, [&](util::Optional<app::AppError> error) {
+                refreshed.set_value(std::move(error));
+            });
+            if (refreshed.get_future().get()) {
+                // Transient failure (e.g. network down) - an auth failure logs
+                // the user out and ends the loop above. Back off rather than
+                // spinning on the still-stale expiry.
+                std::this_thread::sleep_for(std::chrono::minutes(2));
+            }
+        }
+        unwatch(user->identity());
+    }
+};
+
 template<typename T>
 class User : public SharedUser {
 public:
@@ -209,6 +305,7 @@ inline typename T::Function UserClass<T>::create_constructor(ContextType ctx) {
 
 template<typename T>
 typename T::Object UserClass<T>::create_instance(ContextType ctx, SharedUser user, SharedApp app) {
+    AccessTokenRefreshScheduler::shared().watch(app, user);
     return create_object<T, UserClass<T>>(ctx, new User<T>(std::move(user), std::move(app)));
 }
 
@@ -358,13 +455,36 @@ void UserClass<T>::call_function(ContextType ctx, ObjectType this_object, Argume
     auto user = get_internal<T, UserClass<T>>(ctx, this_object);
 
     auto name = Value::validated_to_string(ctx, args[0], "name");
-    auto stringified_ejson_args = Value::validated_to_string(ctx, args[1], "args");
     auto service = Value::is_undefined(ctx, args[2])
             ? util::none
             : util::Optional<std::string>(Value::validated_to_string(ctx, args[2], "service"));
     auto callback = Value::validated_to_function(ctx, args[3], "callback");
 
-    auto bson_args = String::to_bson(stringified_ejson_args);
+    // Arguments arrive either as stringified EJSON or, on the opt-in binary
+    // path, as binary BSON in an ArrayBuffer. Binary requests get a binary
+    // response; the encoded result is handed to JS without copying.
+    bool binary = Value::is_binary(ctx, args[1]);
+    bson::Bson bson_args;
+    if (binary) {
+        auto data = Value::validated_to_binary(ctx, args[1], "args");
+        // BSON cannot carry a bare array at the top level, so the JS side
+        // wraps the arguments: { arguments: [...] }.
+        auto request = bson_binary::decode(data.data(), data.size());
+        bool found = false;
+        for (auto& pair : request.operator const bson::BsonDocument&()) {
+            if (pair.first == "arguments") {
+                bson_args = pair.second;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            throw std::invalid_argument("Binary function arguments must be a BSON document with an 'arguments' array");
+        }
+    }
+    else {
+        bson_args = String::to_bson(Value::validated_to_string(ctx, args[1], "args"));
+    }
 
     user->m_app->call_function(
         *user,
@@ -372,8 +492,13 @@ void UserClass<T>::call_function(ContextType ctx, ObjectType this_object, Argume
         bson_args.operator const bson::BsonArray&(),
         service,
         Function::wrap_callback_error_first(ctx, this_object, callback,
-            [] (ContextType ctx, const util::Optional<bson::Bson>& result) {
+            [binary] (ContextType ctx, const util::Optional<bson::Bson>& result) {
                 REALM_ASSERT_RELEASE(result);
+                if (binary) {
+                    bson::BsonDocument wrapper;
+                    wrapper["result"] = *result;
+                    return Value::from_external_binary(ctx, bson_binary::encode(bson::Bson(wrapper)));
+                }
                 return Value::from_string(ctx, String::from_bson(*result));
             }));
 }
@@ -429,14 +554,14 @@ void UserClass<T>::make_streaming_request(ContextType ctx, ObjectType this_objec
     auto name = Value::validated_to_string(ctx, args[0], "name");
     auto service = Value::validated_to_string(ctx, args[1], "service");
     auto stringified_ejson_args = Value::validated_to_string(ctx, args[2], "args");
-    auto bson_args = String::to_bson(stringified_ejson_args);
+    auto bson_args = String::to_bson(std::move(stringified_ejson_args));
 
     auto req = user->m_app->make_streaming_request(
         *user,
         name,
         bson_args.operator const bson::BsonArray &(),
         std::string(service));
-    return return_value.set(JavaScriptNetworkTransport<T>::makeRequest(ctx, req));
+    return return_value.set(JavaScriptNetworkTransport<T>::makeRequest(ctx, std::move(req)));
 }
 
 template<typename T>
@@ -94,6 +94,41 @@ static inline void validate_argument_count_at_least(size_t count, size_t expecte
     }
 }
 
+template<typename T>
+void compute_count_on_collection(typename T::ContextType ctx, typename T::ObjectType this_object,
+                                 typename T::Arguments &args, typename T::ReturnValue &return_value) {
+    auto collection = get_internal<typename T::Type, T>(ctx, this_object);
+    args.validate_maximum(1);
+
+    if (args.count == 0) {
+        return_value.set((uint32_t)collection->size());
+        return;
+    }
+
+    if (collection->get_type() != realm::PropertyType::Object) {
+        throw std::invalid_argument("Cannot count a property on a collection of primitives");
+    }
+
+    const ObjectSchema& object_schema = collection->get_object_schema();
+    std::string property_name = T::Value::validated_to_string(ctx, args[0]);
+    const Property* property = object_schema.property_for_name(property_name);
+    if (!property) {
+        throw std::invalid_argument(util::format("Property '%1' does not exist on object '%2'",
+                                                 property_name, object_schema.name));
+    }
+
+    // One native pass over the view; no per-row boxing.
+    ColKey column = property->column_key;
+    size_t count = 0;
+    size_t size = collection->size();
+    for (size_t i = 0; i < size; i++) {
+        if (!collection->template get<Obj>(i).is_null(column)) {
+            count++;
+        }
+    }
+    return_value.set((uint32_t)count);
+}
+
 template<typename T, AggregateFunc func>
 void compute_aggregate_on_collection(typename T::ContextType ctx, typename T::ObjectType this_object,
                                      typename T::Arguments &args, typename T::ReturnValue &return_value) {
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "jsc_types.hpp"
+#include "jsc_string.hpp"
 
 #include "js_class.hpp"
 #include "js_util.hpp"
@@ -413,7 +414,7 @@ inline JSValueRef ObjectWrap<ClassType>::native_property_getter_callback(JSConte
     JSValueRef error = nullptr;
 
     void* data = JSObjectGetPrivate(function);
-    JSValueRef value = JSObjectGetProperty(ctx, function, JSStringCreateWithUTF8CString("propertyName"), &error);
+    JSValueRef value = JSObjectGetProperty(ctx, function, *get_cached_property_name("propertyName"), &error);
     if (error) {
         *exception = error;
         return nullptr;
@@ -445,18 +446,18 @@ void ObjectWrap<ClassType>::define_accessor_for_schema_property(JSContextRef ctx
     JSObjectRef getter = JSObjectMake(ctx, m_getterAccessorClass, name);
     JSObjectSetPrototype(ctx, getter, FunctionPrototype);
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("get"), getter, kJSPropertyAttributeReadOnly, &exception);
+    JSObjectSetProperty(ctx, descriptor, *get_cached_property_name("get"), getter, kJSPropertyAttributeReadOnly, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
     
     JSObjectRef setter = JSObjectMake(ctx, m_setterAccessorClass, name);
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("set"), setter, kJSPropertyAttributeReadOnly, &exception);
+    JSObjectSetProperty(ctx, descriptor, *get_cached_property_name("set"), setter, kJSPropertyAttributeReadOnly, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("enumerable"), Value::from_boolean(ctx, true), kJSPropertyAttributeReadOnly, &exception);
+    JSObjectSetProperty(ctx, descriptor, *get_cached_property_name("enumerable"), Value::from_boolean(ctx, true), kJSPropertyAttributeReadOnly, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
@@ -477,12 +478,12 @@ void ObjectWrap<ClassType>::define_native_property_accessor(JSContextRef ctx,
 
     JSObjectRef getter = JSObjectMake(ctx, m_NativePropertyGetterClass, (void*)getCallback);
     JSObjectSetPrototype(ctx, getter, FunctionPrototype);
-    JSObjectSetProperty(ctx, getter, JSStringCreateWithUTF8CString("propertyName"), Value::from_string(ctx, *name), kJSPropertyAttributeReadOnly, &exception);
+    JSObjectSetProperty(ctx, getter, *get_cached_property_name("propertyName"), Value::from_string(ctx, *name), kJSPropertyAttributeReadOnly, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("get"), getter, kJSPropertyAttributeReadOnly, &exception);
+    JSObjectSetProperty(ctx, descriptor, *get_cached_property_name("get"), getter, kJSPropertyAttributeReadOnly, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
@@ -493,39 +494,23 @@ void ObjectWrap<ClassType>::define_native_property_accessor(JSContextRef ctx,
     Function::call(ctx, ObjectDefineProperty, nullptr /*this*/, 3, arguments);
 }
 
-//A cache for property names. The pair is property name and a node::String* to the same string representation.
-//The cache is persisted throughout the process life time to preseve property names between constructor cache invalidations (on_destory_context is called) 
-//Since RealmObjectClass instances may be used after context is destroyed, their property names should be valid
-static std::unordered_map<std::string, jsc::String*> propertyNamesCache;
-
-static jsc::String* get_cached_property_name(const std::string& name) {
-	if (propertyNamesCache.count(name)) {
-		jsc::String* cachedName = propertyNamesCache.at(name);
-		return cachedName;
-	}
-
-	jsc::String* result = new jsc::String(name);
-	propertyNamesCache.emplace(name, result);
-	return result;
-}
-
 static void define_function_property(JSContextRef ctx, JSObjectRef& target, const char* name, const JSObjectCallAsFunctionCallback& callback) {
     JSObjectRef descriptor = Object::create_empty(ctx);
-    
-    JSObjectRef functionValue = JSObjectMakeFunctionWithCallback(ctx, JSStringCreateWithUTF8CString(name), callback);
+
+    JSObjectRef functionValue = JSObjectMakeFunctionWithCallback(ctx, *get_cached_property_name(name), callback);
 
     JSValueRef exception = nullptr;
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("value"), functionValue, kJSPropertyAttributeNone, &exception);
+    JSObjectSetProperty(ctx, descriptor, *get_cached_property_name("value"), functionValue, kJSPropertyAttributeNone, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("writable"), Value::from_boolean(ctx, true), kJSPropertyAttributeNone, &exception);
+    JSObjectSetProperty(ctx, descriptor, *get_cached_property_name("writable"), Value::from_boolean(ctx, true), kJSPropertyAttributeNone, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("configurable"), Value::from_boolean(ctx, true), kJSPropertyAttributeNone, &exception);
+    JSObjectSetProperty(ctx, descriptor, *get_cached_property_name("configurable"), Value::from_boolean(ctx, true), kJSPropertyAttributeNone, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
@@ -643,16 +628,16 @@ inline void ObjectWrap<ClassType>::define_schema_properties(JSContextRef ctx, JS
     //get all properties from the schema 
     for (auto& property : schema.persisted_properties) {
         std::string propName = property.public_name.empty() ? property.name : property.public_name;
-        if (redefine || !JSObjectHasProperty(ctx, constructorPrototype, JSStringCreateWithUTF8CString(propName.c_str()))) {
-            jsc::String* name = get_cached_property_name(propName);
+        jsc::String* name = get_cached_property_name(propName);
+        if (redefine || !JSObjectHasProperty(ctx, constructorPrototype, *name)) {
             define_accessor_for_schema_property(ctx, constructorPrototype, name);
         }
     }
 
     for (auto& property : schema.computed_properties) {
         std::string propName = property.public_name.empty() ? property.name : property.public_name;
-        if (redefine || !JSObjectHasProperty(ctx, constructorPrototype, JSStringCreateWithUTF8CString(propName.c_str()))) {
-            jsc::String* name = get_cached_property_name(propName);
+        jsc::String* name = get_cached_property_name(propName);
+        if (redefine || !JSObjectHasProperty(ctx, constructorPrototype, *name)) {
             define_accessor_for_schema_property(ctx, constructorPrototype, name);
         }
     }
@@ -674,18 +659,19 @@ inline JSObjectRef ObjectWrap<ClassType>::create_instance_by_schema(JSContextRef
     JSObjectRef instance;
     JSValueRef value;
 
-    auto config = internal->realm()->config();
-	std::string path = config.path;
+    //avoid copying the whole Realm::Config per created wrapper; only the path is needed for the cache key
+    const std::string& path = internal->realm()->config().path;
 	auto version = internal->realm()->schema_version();
-	std::string schemaName = schema.name + ":" + util::to_string(version); 
+	std::string schemaName = schema.name + ":" + util::to_string(version);
 
 	std::unordered_map<std::string, SchemaObjectType*>* schemaObjects = nullptr;
-	if (!s_schemaObjectTypes.count(path)) {
+	auto schemaObjectsIt = s_schemaObjectTypes.find(path);
+	if (schemaObjectsIt == s_schemaObjectTypes.end()) {
 		schemaObjects = new std::unordered_map<std::string, SchemaObjectType*>();
 		s_schemaObjectTypes.emplace(path, schemaObjects);
 	}
 	else {
-		schemaObjects = s_schemaObjectTypes.at(path);
+		schemaObjects = schemaObjectsIt->second;
 	}
     
     JSObjectRef schemaObjectConstructor;
@@ -694,7 +680,8 @@ inline JSObjectRef ObjectWrap<ClassType>::create_instance_by_schema(JSContextRef
 
     //if we are creating a RealmObject from schema with no user defined constructor
 	if (constructor == nullptr) {
-        if (!schemaObjects->count(schemaName)) {
+        auto schemaObjectTypeIt = schemaObjects->find(schemaName);
+        if (schemaObjectTypeIt == schemaObjects->end()) {
             
             JSClassDefinition definition = kJSClassDefinitionEmpty;
             definition.className = schema.name.c_str();
@@ -715,7 +702,7 @@ inline JSObjectRef ObjectWrap<ClassType>::create_instance_by_schema(JSContextRef
         }
         else {
             //hot path. The constructor for this schema object is already cached.
-            schemaObjectType = schemaObjects->at(schemaName);
+            schemaObjectType = schemaObjectTypeIt->second;
             schemaObjectConstructor = schemaObjectType->constructor;
         }
 
@@ -728,11 +715,12 @@ inline JSObjectRef ObjectWrap<ClassType>::create_instance_by_schema(JSContextRef
     }
     else {
         //creating a RealmObject with user defined constructor
-        bool schemaExists = schemaObjects->count(schemaName);
+        auto schemaObjectTypeIt = schemaObjects->find(schemaName);
+        bool schemaExists = schemaObjectTypeIt != schemaObjects->end();
 		if (schemaExists) {
-			schemaObjectType = schemaObjects->at(schemaName);
+			schemaObjectType = schemaObjectTypeIt->second;
 			schemaObjectConstructor = schemaObjectType->constructor;
-			
+
 			//check if constructors have changed for the same schema object and name
 			if (!JSValueIsStrictEqual(ctx, schemaObjectConstructor, constructor)) {
 				schemaExists = false;
@@ -742,9 +730,6 @@ inline JSObjectRef ObjectWrap<ClassType>::create_instance_by_schema(JSContextRef
 
 		//hot path. The constructor for this schema object is already cached. use it and return a new instance
 		if (schemaExists) {
-			schemaObjectType = schemaObjects->at(schemaName);
-			schemaObjectConstructor = schemaObjectType->constructor;
-
             instance = Function::construct(ctx, schemaObjectConstructor, 0, {});
             set_internal_property(ctx, instance, internal);
 			return instance;
@@ -767,14 +752,14 @@ inline JSObjectRef ObjectWrap<ClassType>::create_instance_by_schema(JSContextRef
 			//setup all RealmObjectClass<T> methods to the prototype of the object
 			for (auto& pair : s_class.methods) {
 				//don't redefine if exists
-                if (!JSObjectHasProperty(ctx, constructorPrototype, JSStringCreateWithUTF8CString(pair.first.c_str()))) {
+                if (!JSObjectHasProperty(ctx, constructorPrototype, *get_cached_property_name(pair.first))) {
                     define_function_property(ctx, constructorPrototype, pair.first.c_str(), pair.second);
 				}
 			}
 
 			for (auto& pair : s_class.properties) {
 				//don't redefine if exists
-				if (!JSObjectHasProperty(ctx, constructorPrototype, JSStringCreateWithUTF8CString(pair.first.c_str()))) {
+				if (!JSObjectHasProperty(ctx, constructorPrototype, *get_cached_property_name(pair.first))) {
                     jsc::String* name = get_cached_property_name(pair.first);
                     JSObjectGetPropertyCallback getterCallback = pair.second.getter;
                     define_native_property_accessor(ctx, constructorPrototype, name, getterCallback);
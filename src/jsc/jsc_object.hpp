@@ -19,6 +19,7 @@
 #pragma once
 
 #include "jsc_types.hpp"
+#include "jsc_string.hpp"
 
 namespace realm {
 namespace js {
@@ -35,7 +36,24 @@ inline JSValueRef jsc::Object::get_property(JSContextRef ctx, const JSObjectRef
 
 template<>
 inline JSValueRef jsc::Object::get_property(JSContextRef ctx, const JSObjectRef &object, StringData key) {
-    return get_property(ctx, object, jsc::String(key));
+    //names coming in as raw strings repeat across accesses, so reuse the
+    //interned JSStringRef instead of re-encoding the name every time
+    return get_property(ctx, object, *jsc::get_cached_property_name(key));
+}
+
+template<>
+inline JSValueRef jsc::Object::get_property(JSContextRef ctx, const JSObjectRef &object, const JSValueRef &key) {
+    JSValueRef exception = nullptr;
+    JSStringRef key_string = JSValueToStringCopy(ctx, key, &exception);
+    if (exception) {
+        throw jsc::Exception(ctx, exception);
+    }
+    JSValueRef value = JSObjectGetProperty(ctx, object, key_string, &exception);
+    JSStringRelease(key_string);
+    if (exception) {
+        throw jsc::Exception(ctx, exception);
+    }
+    return value;
 }
 
 template<>
@@ -57,6 +75,14 @@ inline void jsc::Object::set_property(JSContextRef ctx, JSObjectRef &object, con
     }
 }
 
+template<>
+inline void jsc::Object::set_lazy_property(JSContextRef ctx, const JSObjectRef &object, const jsc::String &key, JSValueRef (*factory)(JSContextRef)) {
+    // JavaScriptCore has no define-accessor API in this binding, so the
+    // property is populated eagerly.
+    JSObjectRef obj = object;
+    set_property(ctx, obj, key, factory(ctx), js::ReadOnly | js::DontEnum | js::DontDelete);
+}
+
 template<>
 inline void jsc::Object::set_property(JSContextRef ctx, JSObjectRef &object, uint32_t index, const JSValueRef &value) {
     JSValueRef exception = nullptr;
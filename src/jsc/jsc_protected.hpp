@@ -128,5 +128,22 @@ class Protected<JSObjectRef> : public Protected<JSValueRef> {
     }
 };
 
+// JavaScriptCore has no public weak-value API, so this stub behaves as an
+// always-collected reference and callers take their fresh-object fallback.
+template<>
+class WeakObjectReference<JSObjectRef> {
+  public:
+    WeakObjectReference() = default;
+    WeakObjectReference(JSContextRef, JSObjectRef) {}
+
+    explicit operator bool() const {
+        return false;
+    }
+
+    JSObjectRef get() const {
+        return nullptr;
+    }
+};
+
 } // js
 } // realm
@@ -53,7 +53,7 @@ class ReturnValue<jsc::Types> {
     void set(uint32_t number) {
         m_value = JSValueMakeNumber(m_context, number);
     }
-    void set(realm::Mixed mixed) {
+    void set(const realm::Mixed& mixed) {
         m_value = Value<jsc::Types>::from_mixed(m_context, nullptr, mixed);
     }
     void set_null() {
@@ -22,6 +22,7 @@
 #include <realm/object-store/sync/generic_network_transport.hpp>
 #include "js_types.hpp"
 #include "js_network_transport.hpp"
+#include "native_network_transport.hpp"
 
 namespace realm {
 namespace rpc {
@@ -53,9 +54,20 @@ struct RPCNetworkTransport : public app::GenericNetworkTransport {
 
     RPCNetworkTransport(ContextType ctx) : m_ctx(ctx) {}
 
-    void send_request_to_server(const app::Request request, std::function<void(const app::Response)> completion_callback) override {
+    void send_request_to_server(app::Request request, std::function<void(const app::Response)> completion_callback) override {
+        // When a platform-native HTTP backend is registered (see
+        // native_network_transport.hpp), execute the request natively instead
+        // of round-tripping it through the debugger's RPC bridge as JSON -
+        // only the completed response crosses back into the debug session.
+        if (js::native_transport_factory) {
+            if (!m_native_transport) {
+                m_native_transport = js::native_transport_factory();
+            }
+            m_native_transport->send_request_to_server(std::move(request), std::move(completion_callback));
+            return;
+        }
         // Build up a JS request object
-        auto request_object = js::JavaScriptNetworkTransport<T>::makeRequest(m_ctx, request);
+        auto request_object = js::JavaScriptNetworkTransport<T>::makeRequest(m_ctx, std::move(request));
         // Ask the RPC layer to enqueue a call to the client-side fetch function
         Function::call(m_ctx, fetch_function, nullptr, {
             request_object,
@@ -65,6 +77,7 @@ struct RPCNetworkTransport : public app::GenericNetworkTransport {
 
 private:
     ContextType m_ctx;
+    std::unique_ptr<app::GenericNetworkTransport> m_native_transport;
 };
 
 }
@@ -20,6 +20,11 @@
 
 #include "jsc_types.hpp"
 
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace realm {
 namespace js {
 
@@ -38,10 +43,10 @@ class String<jsc::Types> {
         return String(bson.to_string());
     }
 
-    String(const char *s) : m_str(JSStringCreateWithUTF8CString(s)) {}
+    String(const char *s) : String(s, strlen(s)) {}
     String(const JSStringRef &s) : m_str(JSStringRetain(s)) {}
-    String(StringData str) : String(str.data()) {}
-    String(const std::string& str) : String(str.c_str()) {}
+    String(StringData str) : String(str.data(), str.size()) {}
+    String(const std::string& str) : String(str.data(), str.size()) {}
     String(const StringType &o) : String(o.m_str) {}
     String(StringType &&o) : m_str(o.m_str) {
         o.m_str = nullptr;
@@ -56,13 +61,92 @@ class String<jsc::Types> {
         return m_str;
     }
     operator std::string() const {
+        size_t length = JSStringGetLength(m_str);
+        const JSChar* chars = JSStringGetCharactersPtr(m_str);
+        if (chars && is_ascii(chars, length)) {
+            // ASCII fast path: narrow the UTF-16 data directly into the result.
+            // The plain loop vectorizes on both SSE and NEON targets and skips
+            // the 3x worst-case allocation of JSStringGetMaximumUTF8CStringSize.
+            std::string string(length, '\0');
+            for (size_t i = 0; i < length; i++) {
+                string[i] = static_cast<char>(chars[i]);
+            }
+            return string;
+        }
+
         size_t max_size = JSStringGetMaximumUTF8CStringSize(m_str);
         std::string string;
         string.resize(max_size);
         string.resize(JSStringGetUTF8CString(m_str, &string[0], max_size) - 1);
         return string;
     }
+
+  private:
+    String(const char *s, size_t size) {
+        if (is_ascii(s, size)) {
+            // ASCII fast path: widening the bytes to UTF-16 ourselves skips
+            // JSC's scalar UTF-8 decoder; the loop auto-vectorizes.
+            JSChar stack_chars[64];
+            if (size <= sizeof(stack_chars) / sizeof(JSChar)) {
+                for (size_t i = 0; i < size; i++) {
+                    stack_chars[i] = static_cast<JSChar>(static_cast<unsigned char>(s[i]));
+                }
+                m_str = JSStringCreateWithCharacters(stack_chars, size);
+                return;
+            }
+
+            std::vector<JSChar> chars(size);
+            for (size_t i = 0; i < size; i++) {
+                chars[i] = static_cast<JSChar>(static_cast<unsigned char>(s[i]));
+            }
+            m_str = JSStringCreateWithCharacters(chars.data(), size);
+            return;
+        }
+
+        // non-ASCII data still goes through JSC's converter, which needs a
+        // null-terminated buffer
+        m_str = JSStringCreateWithUTF8CString(std::string(s, size).c_str());
+    }
+
+    static bool is_ascii(const char *s, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            if (static_cast<unsigned char>(s[i]) >= 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool is_ascii(const JSChar *chars, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            if (chars[i] >= 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
 };
-    
+
 } // js
+
+namespace jsc {
+
+//A cache for property names. The pair is property name and a jsc::String* to the same string representation.
+//The cache is persisted throughout the process life time to preseve property names between constructor cache invalidations (on_destory_context is called)
+//Since RealmObjectClass instances may be used after context is destroyed, their property names should be valid.
+//Interning the names also means the JSStringRef and its UTF-8 to UTF-16 conversion are created once per name instead of on every access
+static std::unordered_map<std::string, js::String<Types>*> propertyNamesCache;
+
+static inline js::String<Types>* get_cached_property_name(const std::string& name) {
+	if (propertyNamesCache.count(name)) {
+		js::String<Types>* cachedName = propertyNamesCache.at(name);
+		return cachedName;
+	}
+
+	js::String<Types>* result = new js::String<Types>(name);
+	propertyNamesCache.emplace(name, result);
+	return result;
+}
+
+} // jsc
 } // realm
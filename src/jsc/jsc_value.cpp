@@ -65,6 +65,29 @@ JSValueRef jsc::Value::from_nonnull_binary(JSContextRef ctx, BinaryData data)
     return jsc::Object::validated_get_object(ctx, uint8_array, s_buffer);
 }
 
+template<>
+JSValueRef jsc::Value::from_external_binary(JSContextRef ctx, std::string&& data)
+{
+    if (data.empty()) {
+        return from_nonnull_binary(ctx, BinaryData());
+    }
+
+    // The ArrayBuffer adopts the string's heap allocation; the deallocator
+    // frees it when the buffer is garbage collected.
+    auto heap_data = std::make_unique<std::string>(std::move(data));
+    JSValueRef exception = nullptr;
+    JSObjectRef buffer = JSObjectMakeArrayBufferWithBytesNoCopy(ctx, &(*heap_data)[0], heap_data->size(),
+        [](void*, void* deallocator_context) {
+            delete static_cast<std::string*>(deallocator_context);
+        }, heap_data.get(), &exception);
+    if (exception) {
+        throw jsc::Exception(ctx, exception);
+    }
+    heap_data.release();
+
+    return buffer;
+}
+
 template<>
 JSValueRef jsc::Value::from_decimal128(JSContextRef ctx, const Decimal128& value)
 {
@@ -162,6 +185,15 @@ OwnedBinaryData jsc::Value::to_binary(JSContextRef ctx, const JSValueRef &value)
     return OwnedBinaryData(std::move(buffer), byte_count);
 }
 
+template<>
+BinaryData jsc::Value::to_binary_view(JSContextRef ctx, const JSValueRef& value)
+{
+    // JavaScriptCore does not expose a bytes pointer through the APIs this
+    // binding targets, so there is no stable view to hand out. Returning a
+    // null view makes callers fall back to the copying to_binary() path.
+    return BinaryData();
+}
+
 template<>
 Decimal128 jsc::Value::to_decimal128(JSContextRef ctx, const JSValueRef& value)
 {
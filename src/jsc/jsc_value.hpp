@@ -141,7 +141,7 @@ inline bool is_bson_type(JSContextRef ctx, const JSValueRef &value, std::string
         throw jsc::Exception(ctx, error);
     }
 
-    JSValueRef bson_type = JSObjectGetProperty(ctx, object, JSStringCreateWithUTF8CString("_bsontype"), &error);
+    JSValueRef bson_type = JSObjectGetProperty(ctx, object, *jsc::get_cached_property_name("_bsontype"), &error);
     if (error) {
         throw jsc::Exception(ctx, error);
     }
@@ -174,7 +174,7 @@ inline bool is_ejson_type(JSContextRef ctx, const JSValueRef &value, std::string
         throw jsc::Exception(ctx, error);
     }
 
-    JSStringRef property_name_string = JSStringCreateWithUTF8CString(property_name.c_str());
+    JSStringRef property_name_string = *jsc::get_cached_property_name(property_name);
     auto property = JSObjectGetProperty(ctx, object, property_name_string, &error);
     if (error) {
         throw jsc::Exception(ctx, error);
@@ -214,6 +214,12 @@ inline JSValueRef jsc::Value::from_number(JSContextRef ctx, double number) {
     return JSValueMakeNumber(ctx, number);
 }
 
+template<>
+inline JSValueRef jsc::Value::from_integer(JSContextRef ctx, int64_t number) {
+    // JSC numbers are always doubles; there is no separate integer path.
+    return JSValueMakeNumber(ctx, double(number));
+}
+
 template<>
 inline JSValueRef jsc::Value::from_nonnull_string(JSContextRef ctx, const jsc::String &string) {
     return JSValueMakeString(ctx, string);
@@ -227,6 +233,9 @@ inline JSValueRef jsc::Value::from_undefined(JSContextRef ctx) {
 template<>
 JSValueRef jsc::Value::from_nonnull_binary(JSContextRef ctx, BinaryData data);
 
+template<>
+JSValueRef jsc::Value::from_external_binary(JSContextRef ctx, std::string&& data);
+
 template<>
 JSValueRef jsc::Value::from_decimal128(JSContextRef ctx, const Decimal128& value);
 
@@ -268,6 +277,11 @@ inline double jsc::Value::to_number(JSContextRef ctx, const JSValueRef &value) {
     return number;
 }
 
+template<>
+inline int64_t jsc::Value::to_integer(JSContextRef ctx, const JSValueRef &value) {
+    return int64_t(to_number(ctx, value));
+}
+
 
 template<>
 inline JSObjectRef jsc::Value::to_object(JSContextRef ctx, const JSValueRef &value) {
@@ -311,6 +325,9 @@ inline JSObjectRef jsc::Value::to_function(JSContextRef ctx, const JSValueRef &v
 template<>
 OwnedBinaryData jsc::Value::to_binary(JSContextRef ctx, const JSValueRef& value);
 
+template<>
+BinaryData jsc::Value::to_binary_view(JSContextRef ctx, const JSValueRef& value);
+
 template<>
 Decimal128 jsc::Value::to_decimal128(JSContextRef ctx, const JSValueRef& value);
 
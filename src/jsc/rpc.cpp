@@ -19,6 +19,7 @@
 #include <cassert>
 #include <dlfcn.h>
 #include <map>
+#include <unordered_map>
 #include <functional>
 #include <future>
 #include <thread>
@@ -78,9 +79,12 @@ class RPCWorker {
     std::thread m_thread;
     CFRunLoopRef m_loop;
 #endif
-    ConcurrentDeque<std::function<void()>> m_tasks;
+    // tasks and callbacks only ever cross from producers to the worker thread,
+    // so they ride the lock-free MPSC queue; promises keep the deque because
+    // nested calls pop them in LIFO order.
+    ConcurrentMPSCQueue<std::function<void()>> m_tasks;
     ConcurrentDeque<std::promise<json>> m_promises;
-    ConcurrentDeque<json> m_callbacks;
+    ConcurrentMPSCQueue<json> m_callbacks;
 };
 
 class RPCServerImpl {
@@ -93,19 +97,31 @@ private:
     JSGlobalContextRef m_context;
     std::mutex m_request_mutex;
     std::map<std::string, RPCRequest> m_requests;
-    std::map<RPCObjectID, js::Protected<JSObjectRef>> m_objects;
-    std::map<RPCObjectID, js::Protected<JSObjectRef>> m_callbacks;
+    std::unordered_map<RPCObjectID, js::Protected<JSObjectRef>> m_objects;
+    // Reverse index of m_objects so serializing the same object repeatedly
+    // reuses one id instead of piling up a new protected reference per
+    // message. Keyed by raw pointer for the same reason as m_callback_ids.
+    std::unordered_map<JSObjectRef, RPCObjectID> m_object_ids;
+    std::unordered_map<RPCObjectID, js::Protected<JSObjectRef>> m_callbacks;
     // The key here is the same as the value in m_callbacks. We use the raw pointer as a key here,
     // because protecting the value in m_callbacks pins the function object and prevents it from being moved
     // by the garbage collector upon compaction.
-    std::map<JSObjectRef, RPCObjectID> m_callback_ids;
+    std::unordered_map<JSObjectRef, RPCObjectID> m_callback_ids;
     RPCObjectID m_session_id;
     RPCWorker m_worker;
     u_int64_t m_callback_call_counter;
     uint64_t m_reset_counter = 0;
 
+    // Keyed completion map: each (callback id, call counter) pair owns its
+    // promise, so resolving a result wakes exactly its waiter in O(1) no
+    // matter how deeply debug-session callbacks nest.
+    struct PendingCallbackKeyHash {
+        size_t operator()(const std::pair<uint64_t, uint64_t>& key) const {
+            return std::hash<uint64_t>()(key.first) ^ (std::hash<uint64_t>()(key.second) * 31);
+        }
+    };
     std::mutex m_pending_callbacks_mutex;
-    std::map<std::pair<uint64_t, uint64_t>, std::promise<json>> m_pending_callbacks;
+    std::unordered_map<std::pair<uint64_t, uint64_t>, std::promise<json>, PendingCallbackKeyHash> m_pending_callbacks;
 
     NetworkTransportFactory previous_transport_generator;
 
@@ -209,7 +225,7 @@ json RPCWorker::add_task(Fn&& fn) {
     std::promise<json> p;
     auto future = p.get_future();
     m_promises.push_back(std::move(p));
-    m_tasks.push_back([this, fn = std::move(fn)] {
+    m_tasks.push([this, fn = std::move(fn)] {
         auto result = fn();
         m_promises.pop_back().set_value(std::move(result));
     });
@@ -217,11 +233,11 @@ json RPCWorker::add_task(Fn&& fn) {
 }
 
 void RPCWorker::invoke_callback(json callback) {
-    m_tasks.push_back([=, callback = std::move(callback)]() mutable {
+    m_tasks.push([=, callback = std::move(callback)]() mutable {
         if (m_depth == 1) {
             // The callback was invoked directly from the event loop. Push it
             // onto the queue of callbacks to be processed by /callbacks_poll
-            m_callbacks.push_back(std::move(callback));
+            m_callbacks.push(std::move(callback));
         }
         else if (auto promise = m_promises.try_pop_back(0)) {
             // The callback was invoked from within a call to something else,
@@ -231,7 +247,7 @@ void RPCWorker::invoke_callback(json callback) {
         else {
             // The callback was invoked from within a call to something else,
             // but there's no one waiting for the result. Shouldn't be possible?
-            m_callbacks.push_back(std::move(callback));
+            m_callbacks.push(std::move(callback));
         }
     });
 }
@@ -244,7 +260,7 @@ std::future<json> RPCWorker::add_promise() {
 }
 
 json RPCWorker::try_pop_callback() {
-    auto cb = m_callbacks.try_pop_back(0);
+    auto cb = m_callbacks.try_pop(0);
     return cb ? *cb : json::object();
 }
 
@@ -254,7 +270,7 @@ bool RPCWorker::try_run_task() {
     }
 
     // Use a 10 millisecond timeout to keep this thread unblocked.
-    if (auto task = m_tasks.try_pop_back(10)) {
+    if (auto task = m_tasks.try_pop(10)) {
         ++m_depth;
         (*task)();
         --m_depth;
@@ -520,6 +536,32 @@ RPCServerImpl::RPCServerImpl() {
 
         return (json){{"result", serialize_json_value(value)}};
     };
+    m_requests["/read_properties"] = [this](const json dict) {
+        RPCObjectID oid = dict["id"].get<RPCObjectID>();
+
+        json result = json::object();
+        if (JSObjectRef object = get_object(oid)) {
+            for (auto &name : dict["names"]) {
+                auto key = name.get<std::string>();
+                result[key] = serialize_json_value(jsc::Object::get_property(m_context, object, key));
+            }
+        }
+        return (json){{"result", result}};
+    };
+    m_requests["/read_indexes"] = [this](const json dict) {
+        RPCObjectID oid = dict["id"].get<RPCObjectID>();
+        uint32_t start = dict["start"].get<uint32_t>();
+        uint32_t count = dict["count"].get<uint32_t>();
+
+        json values = json::array();
+        if (JSObjectRef object = get_object(oid)) {
+            uint32_t length = jsc::Object::validated_get_length(m_context, object);
+            for (uint32_t index = start; index < length && index < start + count; index++) {
+                values.push_back(serialize_json_value(jsc::Object::get_property(m_context, object, index)));
+            }
+        }
+        return (json){{"result", values}};
+    };
     m_requests["/set_property"] = [this](const json dict) {
         RPCObjectID oid = dict["id"].get<RPCObjectID>();
         json name = dict["name"];
@@ -536,16 +578,22 @@ RPCServerImpl::RPCServerImpl() {
     };
     m_requests["/dispose_object"] = [this](const json dict) {
         RPCObjectID oid = dict["id"].get<RPCObjectID>();
-        m_objects.erase(oid);
+        auto it = m_objects.find(oid);
+        if (it != m_objects.end()) {
+            m_object_ids.erase(static_cast<JSObjectRef>(it->second));
+            m_objects.erase(it);
+        }
         return json::object();
     };
     m_requests["/clear_test_state"] = [this](const json dict) {
         // The session ID points to the Realm constructor object, which should remain.
         auto realm_constructor = m_objects[m_session_id];
         m_objects.clear();
+        m_object_ids.clear();
 
         if (realm_constructor) {
             m_objects.emplace(m_session_id, realm_constructor);
+            m_object_ids.emplace(static_cast<JSObjectRef>(realm_constructor), m_session_id);
         }
 
         // The JS side of things only gives us the fetch function callback
@@ -562,6 +610,15 @@ RPCServerImpl::RPCServerImpl() {
 
         return json::object();
     };
+    m_requests["/registry_stats"] = [this](const json dict) {
+        // Live view of the registry sizes, for watching a debug session's
+        // footprint from the outside (e.g. curl against the RPC port).
+        return (json){{"result", {
+            {"objects", m_objects.size()},
+            {"callbacks", m_callbacks.size()},
+            {"resets", m_reset_counter},
+        }}};
+    };
     m_requests["/set_versions"] = [this](const json dict) {
         JSObjectRef versions = jsc::Value::validated_to_object(m_context, deserialize_json_value(dict["versions"]), "versions");
         AppClass::package_version = jsc::Object::validated_get_string(m_context, versions, "packageVersion");
@@ -721,6 +778,7 @@ RPCServerImpl::~RPCServerImpl() {
 
     // The protected values should be unprotected before releasing the context.
     m_objects.clear();
+    m_object_ids.clear();
     m_callbacks.clear();
 
     // Restore the previous transport generator
@@ -871,8 +929,14 @@ bool RPCServerImpl::try_run_task() {
 RPCObjectID RPCServerImpl::store_object(JSObjectRef object) {
     static RPCObjectID s_next_id = 1;
 
+    auto existing = m_object_ids.find(object);
+    if (existing != m_object_ids.end()) {
+        return existing->second;
+    }
+
     RPCObjectID next_id = s_next_id++;
     m_objects.emplace(next_id, js::Protected<JSObjectRef>(m_context, object));
+    m_object_ids.emplace(object, next_id);
     return next_id;
 }
 
@@ -1171,8 +1235,27 @@ RPCServer::RPCServer() : m_impl(new RPCServerImpl()) {
 
 RPCServer::~RPCServer() = default;
 
-std::string RPCServer::perform_request(std::string const& name, std::string const& json_args) {
-    return m_impl->perform_request(name, json::parse(json_args)).dump();
+static bool is_msgpack_request(std::string const& args) {
+    if (args.empty()) {
+        return false;
+    }
+    // Every RPC payload is a map of named arguments. In MessagePack a map
+    // starts with fixmap (0x80-0x8f), map 16 (0xde) or map 32 (0xdf), none of
+    // which can begin a JSON text, so the first byte identifies the format.
+    uint8_t first = static_cast<uint8_t>(args.front());
+    return (first >= 0x80 && first <= 0x8f) || first == 0xde || first == 0xdf;
+}
+
+std::string RPCServer::perform_request(std::string const& name, std::string const& args) {
+    // The wire format is negotiated per request: binary-capable transports
+    // send MessagePack and get MessagePack back, text-only transports keep
+    // speaking JSON unchanged.
+    if (is_msgpack_request(args)) {
+        auto request = json::from_msgpack(args);
+        std::vector<uint8_t> response = json::to_msgpack(m_impl->perform_request(name, std::move(request)));
+        return std::string(response.begin(), response.end());
+    }
+    return m_impl->perform_request(name, json::parse(args)).dump();
 }
 
 bool RPCServer::try_run_task() {
@@ -29,7 +29,9 @@ class RPCServer {
   public:
     RPCServer();
     ~RPCServer();
-    std::string perform_request(std::string const& name, std::string const& json_args);
+    // `args` is either a JSON text or a MessagePack-encoded map; the response
+    // is returned in the same format the request arrived in.
+    std::string perform_request(std::string const& name, std::string const& args);
     bool try_run_task();
   private:
     std::unique_ptr<RPCServerImpl> m_impl;
@@ -17,9 +17,18 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <iostream>
+#include <condition_variable>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <queue>
+#include <thread>
+
+#include <realm/util/file.hpp>
 
 #include <realm/util/logger.hpp>
 #include <realm/object-store/sync/sync_manager.hpp>  // SyncLoggerFactory
@@ -39,6 +48,22 @@ using LoggerLevel = realm::util::Logger::Level;
 using Entry = std::pair<LoggerLevel, std::string>;
 using Delegated = std::function<void(int, std::string)>;
 
+// Compile-time cap on sync log verbosity. The value is the most verbose
+// LoggerLevel the build will honor (0 = all, 1 = trace, 2 = debug,
+// 3 = detail, ...); requests for anything more verbose are clamped, and since
+// core checks the threshold before formatting, the capped levels cost nothing
+// at the call sites. Defaults to no cap so runtime setLogLevel keeps working.
+#ifndef REALM_JS_MAX_LOG_LEVEL
+#define REALM_JS_MAX_LOG_LEVEL 0
+#endif
+
+// 1-in-N sampling for trace/debug entries (1 keeps everything), so sync
+// diagnostics can stay on in production at a bounded share of the cost.
+// s_debug_sampled_out counts what sampling suppressed.
+static inline std::atomic<unsigned> s_debug_sample_ratio{1};
+static inline std::atomic<uint64_t> s_debug_counter{0};
+static inline std::atomic<uint64_t> s_debug_sampled_out{0};
+
 /*
  * The idea here is to one day implement a functionality to delegate the logs
  * to the mobile OS, for that we got two specialized behaviour that we can
@@ -74,44 +99,249 @@ class IOSLogger {
 };
 #endif
 
+// Entries travel from the sync client thread to the JS thread through a
+// fixed-size SPSC ring of preallocated slots: the producer never takes a lock
+// and slot strings keep their capacity, so steady-state trace logging does no
+// allocation. A mutex-guarded overflow queue catches the (rare) case of the
+// ring filling up faster than the JS thread drains it, and scheduler wakeups
+// are coalesced so one event-loop dispatch delivers everything accumulated.
 class SyncLoggerDelegator : public util::RootLogger {
    public:
     void delegate(Delegated& delegate) {
         m_scheduler->set_notify_callback([this, delegate] {
-            std::queue<Entry> popped;
-            {
-                std::lock_guard<std::mutex> lock(m_mutex);  // Throws
-                popped.swap(m_log_queue);
-            }
+            m_notify_pending.store(false);
 
-            while (!popped.empty()) {
-                Entry& entry = popped.front();
+            size_t tail = m_tail.load(std::memory_order_relaxed);
+            size_t head = m_head.load(std::memory_order_acquire);
+            while (tail != head) {
+                Entry& entry = m_ring[tail % s_ring_size];
                 delegate(static_cast<int>(entry.first), entry.second);
-                popped.pop();
+                ++tail;
+                m_tail.store(tail, std::memory_order_release);
+            }
+
+            if (m_has_overflow.load(std::memory_order_acquire)) {
+                std::queue<Entry> popped;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);  // Throws
+                    popped.swap(m_overflow);
+                    m_has_overflow.store(false, std::memory_order_release);
+                }
+
+                while (!popped.empty()) {
+                    Entry& entry = popped.front();
+                    delegate(static_cast<int>(entry.first), entry.second);
+                    popped.pop();
+                }
             }
         });
     }
 
    protected:
     void do_log(LoggerLevel level, const std::string& message) {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        if (level == LoggerLevel::trace || level == LoggerLevel::debug) {
+            unsigned ratio = s_debug_sample_ratio.load(std::memory_order_relaxed);
+            if (ratio > 1 &&
+                s_debug_counter.fetch_add(1, std::memory_order_relaxed) % ratio != 0) {
+                s_debug_sampled_out.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
 
         // TODO we are coupling core with JS here, change to string use hashmap
         // map_level.
-        auto entry = std::make_pair(level, message);
+        size_t head = m_head.load(std::memory_order_relaxed);
+        bool ring_full = head - m_tail.load(std::memory_order_acquire) >= s_ring_size;
+
+        // Once the overflow queue is in use, keep appending to it until the
+        // JS thread has drained it so delivery order is preserved.
+        if (ring_full || m_has_overflow.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_overflow.emplace(level, message);
+            m_has_overflow.store(true, std::memory_order_release);
+        }
+        else {
+            Entry& slot = m_ring[head % s_ring_size];
+            slot.first = level;
+            slot.second.assign(message);  // reuses the slot's capacity
+            m_head.store(head + 1, std::memory_order_release);
+        }
 
-        m_log_queue.push(entry);
-        m_scheduler->notify();
+        if (!m_notify_pending.exchange(true)) {
+            m_scheduler->notify();
+        }
     }
 
    private:
-    std::queue<Entry> m_log_queue;
+    static constexpr size_t s_ring_size = 256;
+
+    std::array<Entry, s_ring_size> m_ring;
+    std::atomic<size_t> m_head{0};  // written by the logging thread
+    std::atomic<size_t> m_tail{0};  // written by the JS thread
+    std::atomic<bool> m_notify_pending{false};
+
+    std::queue<Entry> m_overflow;
+    std::atomic<bool> m_has_overflow{false};
+
     std::shared_ptr<realm::util::Scheduler> m_scheduler =
         realm::util::Scheduler::make_default();
     std::mutex m_mutex;
     Delegated loggerDelegate;
 };
 
+static inline const char* level_name(LoggerLevel level) {
+    switch (level) {
+        case LoggerLevel::all: return "all";
+        case LoggerLevel::trace: return "trace";
+        case LoggerLevel::debug: return "debug";
+        case LoggerLevel::detail: return "detail";
+        case LoggerLevel::info: return "info";
+        case LoggerLevel::warn: return "warn";
+        case LoggerLevel::error: return "error";
+        case LoggerLevel::fatal: return "fatal";
+        case LoggerLevel::off: return "off";
+    }
+    return "";
+}
+
+// Appends log lines to a memory-mapped, size-rotated file from a background
+// thread. The logging thread only pays for an enqueue and nothing crosses the
+// JS boundary, so field-debugging builds can keep full sync logs on without
+// waking the JS thread per line. The kernel flushes the dirty pages in the
+// background; an explicit sync happens on rotation and shutdown.
+class FileLogSink : public util::RootLogger {
+   public:
+    FileLogSink(std::string path, size_t max_file_size = 4 * 1024 * 1024,
+                unsigned keep_files = 2)
+        : m_path(std::move(path)),
+          m_max_file_size(max_file_size),
+          m_keep_files(keep_files) {
+        open_current_file();
+        m_worker = std::thread([this] { worker_loop(); });
+    }
+
+    ~FileLogSink() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_one();
+        m_worker.join();
+        finish_current_file();
+    }
+
+   protected:
+    void do_log(LoggerLevel level, const std::string& message) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.emplace(level, message);
+        }
+        m_condition.notify_one();
+    }
+
+   private:
+    void worker_loop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_stop || !m_pending.empty()) {
+            if (m_pending.empty()) {
+                m_condition.wait(lock,
+                                 [this] { return m_stop || !m_pending.empty(); });
+                continue;
+            }
+
+            std::queue<Entry> batch;
+            batch.swap(m_pending);
+            lock.unlock();
+            while (!batch.empty()) {
+                append(batch.front());
+                batch.pop();
+            }
+            lock.lock();
+        }
+    }
+
+    void append(const Entry& entry) {
+        const char* name = level_name(entry.first);
+        std::string line;
+        line.reserve(strlen(name) + entry.second.size() + 3);
+        line += name;
+        line += ": ";
+        line += entry.second;
+        line += '\n';
+
+        if (m_offset + line.size() > m_max_file_size) {
+            rotate();
+        }
+        // A single line larger than the whole window cannot fit even in a
+        // fresh file; clamp the copy to the mapping rather than writing past
+        // its end.
+        size_t count = std::min(line.size(), m_max_file_size - m_offset);
+        std::copy_n(line.begin(), count, m_map.get_addr() + m_offset);
+        m_offset += count;
+    }
+
+    void open_current_file() {
+        if (util::File::exists(m_path)) {
+            m_file.open(m_path, util::File::mode_Update);
+            m_offset = static_cast<size_t>(m_file.get_size());
+            // A preexisting file at or past the window (e.g. left by a run
+            // with a larger cap) would put the append offset outside the
+            // mapping; shift it into the rotation and start fresh instead.
+            if (m_offset >= m_max_file_size) {
+                m_file.close();
+                shift_rotated_files();
+                m_file.open(m_path, util::File::mode_Write);
+                m_offset = 0;
+            }
+        }
+        else {
+            m_file.open(m_path, util::File::mode_Write);
+            m_offset = 0;
+        }
+        // Preallocate the full window so the mapping never has to grow.
+        m_file.prealloc(m_max_file_size);
+        m_map = util::File::Map<char>(m_file, util::File::access_ReadWrite,
+                                      m_max_file_size);
+    }
+
+    void finish_current_file() {
+        m_map.sync();
+        m_map.unmap();
+        // Trim the preallocated tail so rotated files end at the last line.
+        m_file.resize(m_offset);
+        m_file.close();
+    }
+
+    void rotate() {
+        finish_current_file();
+        shift_rotated_files();
+        open_current_file();
+    }
+
+    void shift_rotated_files() {
+        for (unsigned i = m_keep_files; i >= 1; i--) {
+            std::string from = i == 1 ? m_path : m_path + "." + std::to_string(i - 1);
+            if (util::File::exists(from)) {
+                util::File::move(from, m_path + "." + std::to_string(i));
+            }
+        }
+    }
+
+    std::string m_path;
+    size_t m_max_file_size;
+    unsigned m_keep_files;
+
+    util::File m_file;
+    util::File::Map<char> m_map;
+    size_t m_offset = 0;
+
+    std::queue<Entry> m_pending;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::thread m_worker;
+    bool m_stop = false;
+};
+
 class Logger {
    private:
     // Warning: If this grows to big (for example: another method) we should
@@ -139,10 +369,35 @@ class Logger {
         throw std::runtime_error("Bad log level");
     }
 
+    // 1-in-N sampling of trace/debug entries; 0 or 1 keeps everything.
+    static void set_debug_sample_ratio(unsigned ratio) {
+        s_debug_sample_ratio.store(ratio == 0 ? 1 : ratio,
+                                   std::memory_order_relaxed);
+    }
+
+    static uint64_t debug_entries_sampled_out() {
+        return s_debug_sampled_out.load(std::memory_order_relaxed);
+    }
+
+    // Like build_sync_logger, but appends to a size-rotated file natively;
+    // the JS delegate is not involved at all.
+    static SyncClientConfig::LoggerFactory build_file_sync_logger(
+        std::string path, size_t max_file_size = 4 * 1024 * 1024,
+        unsigned keep_files = 2) {
+        return [path = std::move(path), max_file_size,
+                keep_files] (realm::util::Logger::Level level) {
+            auto logger = std::make_unique<FileLogSink>(path, max_file_size, keep_files);
+            logger->set_level_threshold(level);
+            return logger;
+        };
+    }
+
     static SyncClientConfig::LoggerFactory build_sync_logger(Delegated& log_fn) {
         return [&log_fn] (realm::util::Logger::Level level) {
             auto logger = std::make_unique<SyncLoggerDelegator>();
-            logger->set_level_threshold(level);
+            constexpr auto max_verbosity =
+                static_cast<realm::util::Logger::Level>(REALM_JS_MAX_LOG_LEVEL);
+            logger->set_level_threshold(std::max(level, max_verbosity));
             logger->delegate(log_fn);
             return logger;
         };
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace realm {
+namespace js {
+
+// Lightweight production instrumentation over the binding hot paths:
+// property dispatch through the proxy traps, predicate parsing in
+// ResultsClass::create_filtered, and write transactions. Everything is a
+// relaxed atomic and the whole layer is off by default, so the only cost
+// when disabled is one relaxed load per hook. Property dispatch fires far
+// too often to count every hit even with atomics, so it is sampled 1-in-N
+// (like the logger's s_debug_sample_ratio) and the reported totals are
+// scaled back up by the ratio.
+//
+// Snapshots are exposed to JS as Realm._metrics(); enable collection with
+// Realm._setMetricsEnabled(true).
+namespace metrics {
+
+static inline std::atomic<bool> s_enabled{false};
+
+// 1-in-N sampling for the property dispatch counters. Each sampled hit adds
+// the whole ratio so the counters always read as (approximate) totals.
+static inline std::atomic<unsigned> s_property_sample_ratio{16};
+
+static inline std::atomic<uint64_t> s_property_gets{0};
+static inline std::atomic<uint64_t> s_property_sets{0};
+static inline std::atomic<uint64_t> s_queries_parsed{0};
+static inline std::atomic<uint64_t> s_writes{0};
+
+// Power-of-two microsecond buckets: bucket 0 is [0,1us), bucket 1 [1,2us),
+// bucket 2 [2,4us), ...; the last bucket absorbs everything slower.
+struct Histogram {
+    static constexpr size_t num_buckets = 16;
+    std::array<std::atomic<uint64_t>, num_buckets> buckets{};
+
+    void record(uint64_t micros) {
+        size_t bucket = 0;
+        while (bucket + 1 < num_buckets && micros >= (uint64_t(1) << bucket)) {
+            bucket++;
+        }
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+static inline Histogram s_query_parse_micros;
+static inline Histogram s_write_micros;
+
+// Always-on native memory accounting, read by Realm._memoryUsage(). These
+// track object lifetimes rather than hot-path hits, so they are not gated
+// on s_enabled - a relaxed increment per wrapper or reference is noise next
+// to the allocation it accompanies.
+static inline std::atomic<int64_t> s_live_wrapped_objects{0};
+static inline std::atomic<int64_t> s_live_protected_refs{0};
+
+// Counts 1-in-s_property_sample_ratio hits, adding the ratio each time so
+// the counter stays an estimate of the true total. The stride counter is
+// thread-local to keep the common (skipped) case free of shared writes.
+inline void count_sampled(std::atomic<uint64_t>& counter) {
+    if (!s_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    unsigned ratio = s_property_sample_ratio.load(std::memory_order_relaxed);
+    if (ratio <= 1) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    thread_local uint64_t stride = 0;
+    if (stride++ % ratio == 0) {
+        counter.fetch_add(ratio, std::memory_order_relaxed);
+    }
+}
+
+inline void count_property_get() {
+    count_sampled(s_property_gets);
+}
+
+inline void count_property_set() {
+    count_sampled(s_property_sets);
+}
+
+// Times a scope and files it under a counter + latency histogram. Reads the
+// clock only when metrics are enabled; the enabled check is re-done in the
+// destructor via the captured flag so a mid-scope toggle cannot record a
+// bogus duration.
+class ScopedTimer {
+  public:
+    ScopedTimer(std::atomic<uint64_t>& counter, Histogram& histogram)
+        : m_counter(counter), m_histogram(histogram),
+          m_armed(s_enabled.load(std::memory_order_relaxed)) {
+        if (m_armed) {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedTimer() {
+        if (!m_armed) {
+            return;
+        }
+        auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_counter.fetch_add(1, std::memory_order_relaxed);
+        m_histogram.record(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  private:
+    std::atomic<uint64_t>& m_counter;
+    Histogram& m_histogram;
+    bool m_armed;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace metrics
+} // namespace js
+} // namespace realm
@@ -0,0 +1,44 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+
+#include <realm/object-store/sync/generic_network_transport.hpp>
+
+namespace realm {
+namespace js {
+
+// Optional platform-native HTTP transport.
+//
+// A platform backend (e.g. src/ios/native_network_transport.mm, backed by
+// NSURLSession) registers its factory here during static initialization.
+// When AppClass::prefer_native_transport is set and a backend is present,
+// App setup uses it instead of JavaScriptNetworkTransport, so auth and
+// function-call traffic runs entirely off the JS thread and reuses the
+// backend's keep-alive connection pool.
+using NativeTransportFactory = std::unique_ptr<app::GenericNetworkTransport> (*)();
+
+// One object program-wide: `static` would give the variable internal linkage
+// and every translation unit its own copy, so the platform backend would
+// register into a copy the readers never see.
+inline NativeTransportFactory native_transport_factory = nullptr;
+
+} // namespace js
+} // namespace realm
@@ -22,13 +22,16 @@
 
 #include "js_class.hpp"
 #include "js_util.hpp"
+#include "metrics.hpp"
 
 #include "napi.h"
 
 #include <ctype.h>
+#include <string.h>
+#include <algorithm>
+#include <memory>
 #include <unordered_set>
 #include <vector>
-#include <functional>
 #include <string>
 #include <unordered_map>
 #include <exception>
@@ -96,13 +99,17 @@ class WrappedObject : public Napi::ObjectWrap<WrappedObject<ClassType>> {
 public:
 	WrappedObject(const Napi::CallbackInfo& info);
 
+	~WrappedObject() {
+		realm::js::metrics::s_live_wrapped_objects.fetch_sub(1, std::memory_order_relaxed);
+	}
+
 	static Napi::Value create_instance_with_proxy(const Napi::CallbackInfo& info);
 
-	static Napi::Function init(Napi::Env env, 
-		const std::string& name, 
-		node::Types::FunctionCallback constructor_callback, 
-		std::function<bool(const std::string&)> has_native_method_callback,
-		const std::vector<Napi::ClassPropertyDescriptor<WrappedObject<ClassType>>>& properties, 
+	static Napi::Function init(Napi::Env env,
+		const std::string& name,
+		node::Types::FunctionCallback constructor_callback,
+		std::vector<std::string> native_methods,
+		const std::vector<Napi::ClassPropertyDescriptor<WrappedObject<ClassType>>>& properties,
 		const IndexPropertyType* indexPropertyHandlers = nullptr);
 
 	static Napi::Object create_instance(Napi::Env env, Internal* internal = nullptr);
@@ -128,9 +135,67 @@ private:
 	static Napi::FunctionReference factory_constructor;
 	static IndexPropertyType* m_indexPropertyHandlers;
 	static std::string m_name;
-	static std::function<bool(const std::string&)> m_has_native_methodFunc;
+	//sorted list of the native method names of this class and its parents, built once in init().
+	//binary searched on the proxy trap hot path instead of calling back into ObjectWrap through a std::function
+	static std::vector<std::string> m_nativeMethods;
 	static Napi::Reference<Napi::External<Internal>> m_nullExternal;
 
+	//membership test over m_nativeMethods hashing the raw UTF-8 bytes, so the
+	//proxy traps can test a name read into a stack buffer without building a
+	//std::string first. Open addressing with linear probing; the table holds
+	//at least twice as many slots as names, so misses terminate quickly.
+	class NativeMethodMatcher {
+	public:
+		void init(const std::vector<std::string>& names) {
+			m_names = &names;
+			size_t capacity = 8;
+			while (capacity < names.size() * 2) {
+				capacity *= 2;
+			}
+			m_slots.assign(capacity, -1);
+			for (size_t i = 0; i < names.size(); i++) {
+				size_t slot = hash(names[i].data(), names[i].size()) & (capacity - 1);
+				while (m_slots[slot] != -1) {
+					slot = (slot + 1) & (capacity - 1);
+				}
+				m_slots[slot] = int32_t(i);
+			}
+		}
+
+		bool contains(const char* data, size_t size) const {
+			if (m_slots.empty()) {
+				return false;
+			}
+			size_t mask = m_slots.size() - 1;
+			size_t slot = hash(data, size) & mask;
+			while (m_slots[slot] != -1) {
+				const std::string& name = (*m_names)[size_t(m_slots[slot])];
+				if (name.size() == size && memcmp(name.data(), data, size) == 0) {
+					return true;
+				}
+				slot = (slot + 1) & mask;
+			}
+			return false;
+		}
+
+	private:
+		//FNV-1a
+		static size_t hash(const char* data, size_t size) {
+			uint64_t h = 14695981039346656037ull;
+			for (size_t i = 0; i < size; i++) {
+				h = (h ^ uint8_t(data[i])) * 1099511628211ull;
+			}
+			return size_t(h);
+		}
+
+		const std::vector<std::string>* m_names = nullptr;
+		std::vector<int32_t> m_slots;
+	};
+	static NativeMethodMatcher m_nativeMethodMatcher;
+
+	static bool has_native_method(const std::string& name);
+	static bool has_native_method(const char* data, size_t size);
+
 	class ProxyHandler {
 		public:
 			static Napi::Value get_instance_proxy_handler(Napi::Env env);
@@ -163,7 +228,10 @@ template<typename ClassType>
 std::string WrappedObject<ClassType>::m_name;
 
 template<typename ClassType>
-std::function<bool(const std::string&)> WrappedObject<ClassType>::m_has_native_methodFunc;
+std::vector<std::string> WrappedObject<ClassType>::m_nativeMethods;
+
+template<typename ClassType>
+typename WrappedObject<ClassType>::NativeMethodMatcher WrappedObject<ClassType>::m_nativeMethodMatcher;
 
 template<typename ClassType>
 Napi::Reference<Napi::External<typename ClassType::Internal>> WrappedObject<ClassType>::m_nullExternal;
@@ -197,6 +265,7 @@ class ObjectWrap {
 
 	static Napi::Value constructor_callback(const Napi::CallbackInfo& info);
 	static bool has_native_method(const std::string& name);
+	static void collect_native_methods(std::vector<std::string>& names);
 
   private:
 	static auto& get_class();
@@ -235,6 +304,9 @@ class ObjectWrap<void> {
 	static bool has_native_method(const std::string& name) {
 		return false;
 	}
+
+	static void collect_native_methods(std::vector<std::string>& names) {
+	}
 };
 
 //Gives access to ObjectWrap<ClassType> init_class private static member. See https://stackoverflow.com/a/40937193
@@ -245,17 +317,39 @@ struct ObjectWrapAccessor {
 	}
 };
 
-static inline std::vector<Napi::Value> get_arguments(const Napi::CallbackInfo& info) {
-	size_t count = info.Length();
-	std::vector<Napi::Value> arguments;
-	arguments.reserve(count);
+//Unpacks the callback arguments into an inline buffer. Native calls overwhelmingly carry 0-3
+//arguments, so this avoids the heap allocation a std::vector would make on every method
+//invocation; larger argument lists spill to the heap.
+class ArgumentsBuffer {
+  public:
+	ArgumentsBuffer(const Napi::CallbackInfo& info) : m_count(info.Length()) {
+		Napi::Value* values = m_inline;
+		if (m_count > s_inline_capacity) {
+			m_spill = std::make_unique<Napi::Value[]>(m_count);
+			values = m_spill.get();
+		}
 
-	for (u_int i = 0; i < count; i++) {
-		arguments.push_back(info[i]);
+		for (size_t i = 0; i < m_count; i++) {
+			values[i] = info[i];
+		}
+		m_values = values;
 	}
 
-	return arguments;
-}
+	size_t count() const {
+		return m_count;
+	}
+
+	const Napi::Value* data() const {
+		return m_values;
+	}
+
+  private:
+	static constexpr size_t s_inline_capacity = 8;
+	size_t m_count;
+	Napi::Value m_inline[s_inline_capacity];
+	std::unique_ptr<Napi::Value[]> m_spill;
+	Napi::Value* m_values;
+};
 
 static inline std::vector<napi_value> napi_get_arguments(const Napi::CallbackInfo& info) {
 	size_t count = info.Length();
@@ -321,6 +415,8 @@ template<typename ClassType>
 WrappedObject<ClassType>::WrappedObject(const Napi::CallbackInfo& info) : Napi::ObjectWrap<WrappedObject<ClassType>>(info) {
 	Napi::Env env = info.Env();
 
+	realm::js::metrics::s_live_wrapped_objects.fetch_add(1, std::memory_order_relaxed);
+
 	//skip the constructor_callback if create_instance is creating a JS instance only
 	if (info.Length() == 1 && info[0].IsExternal())	{
 		Napi::External<Internal> external = info[0].As<Napi::External<Internal>>();
@@ -348,15 +444,17 @@ WrappedObject<ClassType>::WrappedObject(const Napi::CallbackInfo& info) : Napi::
 }
 
 template<typename ClassType>
-Napi::Function WrappedObject<ClassType>::init(Napi::Env env, 
-	const std::string& name, 
-	node::Types::FunctionCallback constructor_callback, 
-	std::function<bool(const std::string&)> has_native_method_callback,
-	const std::vector<Napi::ClassPropertyDescriptor<WrappedObject<ClassType>>>& properties, 
+Napi::Function WrappedObject<ClassType>::init(Napi::Env env,
+	const std::string& name,
+	node::Types::FunctionCallback constructor_callback,
+	std::vector<std::string> native_methods,
+	const std::vector<Napi::ClassPropertyDescriptor<WrappedObject<ClassType>>>& properties,
 	const IndexPropertyType* indexPropertyHandlers) {
 
 	m_name = name;
-	m_has_native_methodFunc = has_native_method_callback;
+	std::sort(native_methods.begin(), native_methods.end());
+	m_nativeMethods = std::move(native_methods);
+	m_nativeMethodMatcher.init(m_nativeMethods);
 	WrappedObject<ClassType>::m_nullExternal = Napi::Persistent(Napi::External<Internal>::New(env, nullptr));
 	WrappedObject<ClassType>::m_nullExternal.SuppressDestruct();
 
@@ -369,6 +467,16 @@ Napi::Function WrappedObject<ClassType>::init(Napi::Env env,
 	return ctor;
 }
 
+template<typename ClassType>
+inline bool WrappedObject<ClassType>::has_native_method(const std::string& name) {
+	return m_nativeMethodMatcher.contains(name.data(), name.size());
+}
+
+template<typename ClassType>
+inline bool WrappedObject<ClassType>::has_native_method(const char* data, size_t size) {
+	return m_nativeMethodMatcher.contains(data, size);
+}
+
 //This creates the required JS instance with a Proxy parent to support get and set handlers and returns a proxy created on the JS instance to support property enumeration handler
 //the returned JS Proxy has only ownKeys trap setup so that all other member accesses skip the Proxy and go directly to the JS instance
 template<typename ClassType>
@@ -591,7 +699,7 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::bind_native_function(Napi::E
 	Napi::EscapableHandleScope scope(env);
 
 	//do not bind the non native functions. These are attached from extensions.js and should be called on the instanceProxy.
-	if (!m_has_native_methodFunc(functionName)) {
+	if (!has_native_method(functionName)) {
 		//return undefined to indicate this is not a native function
 		return scope.Escape(env.Undefined());
 	}
@@ -615,6 +723,8 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::get_proxy_trap(const Napi::C
 	Napi::Env env = info.Env();
 	Napi::EscapableHandleScope scope(env);
 
+	realm::js::metrics::count_property_get();
+
 	Napi::Object target = info[0].As<Napi::Object>();
 	Napi::Value property = info[1];
 
@@ -635,13 +745,31 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::get_proxy_trap(const Napi::C
 		return scope.Escape(propertyValue);
 	}
 
+	//Fast path. Bound native functions get cached as own properties of the proxy target on first access,
+	//so repeated accesses resolve with a single own property check and skip the UTF-8 conversion, the native method name lookup and the re-bind below
+	if (target.HasOwnProperty(property)) {
+		return scope.Escape(target.Get(property));
+	}
+
 	Napi::String propertyName = property.As<Napi::String>();
-	std::string propertyText = propertyName;
 
-	if (propertyText == "_instance") {
+	//Read the name into a stack buffer; virtually every property name fits, which lets
+	//the dispatch below run on the raw UTF-8 bytes without a heap allocation per access.
+	//Longer (possibly truncated) names fall back to the std::string conversion.
+	char nameBuf[64];
+	size_t nameLen = 0;
+	std::string nameStorage;
+	const char* name = nameBuf;
+	if (napi_get_value_string_utf8(env, propertyName, nameBuf, sizeof(nameBuf), &nameLen) != napi_ok || nameLen >= sizeof(nameBuf) - 1) {
+		nameStorage = propertyName;
+		name = nameStorage.c_str();
+		nameLen = nameStorage.size();
+	}
+
+	if (nameLen == 9 && memcmp(name, "_instance", 9) == 0) {
 		return scope.Escape(instance);
 	}
-	
+
 	//Order of execution
 	//1.check for number and call get index handlers
 	//2.check if its a native function
@@ -649,10 +777,10 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::get_proxy_trap(const Napi::C
 
 
 	//1.Check property is number and call index handler
-	char firstChar = *propertyText.c_str();
+	char firstChar = *name;
 
 	//myobject[""] and negative indexes return undefined in JavaScript
-	if (propertyText.length() == 0 || firstChar == '-') {
+	if (nameLen == 0 || firstChar == '-') {
 		return scope.Escape(env.Undefined());
 	}
 
@@ -660,10 +788,11 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::get_proxy_trap(const Napi::C
 	if (isNumber) {
 		int32_t index = 0;
 		try {
-			index = std::stoi(propertyText);
+			//indexes are short enough for the small-string optimization; no heap allocation here
+			index = std::stoi(std::string(name, nameLen));
 		}
 		catch (const std::exception & e) {
-			throw Napi::Error::New(env, "Invalid number " + propertyText);
+			throw Napi::Error::New(env, "Invalid number " + std::string(name, nameLen));
 		}
 
 		WrappedObject<ClassType>* wrappedObject = WrappedObject<ClassType>::Unwrap(instance);
@@ -673,10 +802,13 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::get_proxy_trap(const Napi::C
 
 
 	//2. Check if its a native function
-	if (m_has_native_methodFunc(propertyText)) {
-		//TODO: cache this function in the wrappedObject of this instance
+	if (has_native_method(name, nameLen)) {
 		Napi::Value propertyValue = instance.Get(property);
-		Napi::Value result = bind_function(env, propertyText, propertyValue.As<Napi::Function>(), instance);
+		Napi::Value result = bind_function(env, std::string(name, nameLen), propertyValue.As<Napi::Function>(), instance);
+
+		//cache the bound function on the proxy target for the fast path above.
+		//must stay configurable so the ownKeys trap is not required to report it
+		target.DefineProperty(Napi::PropertyDescriptor::Value(propertyName, result, napi_configurable));
 		return scope.Escape(result);
 	}
 
@@ -690,6 +822,8 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::set_proxy_trap(const Napi::C
 	Napi::Env env = info.Env();
 	Napi::EscapableHandleScope scope(env);
 
+	realm::js::metrics::count_property_set();
+
 	Napi::Object target = info[0].As<Napi::Object>();
 	Napi::Value property = info[1];
 	Napi::Value value = info[2];
@@ -713,21 +847,32 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::set_proxy_trap(const Napi::C
 	}
 
 	Napi::String propertyName = property.As<Napi::String>();
-	std::string propertyText = propertyName;
+
+	//same stack-buffer read as the get trap; the dispatch below only needs the raw bytes
+	char nameBuf[64];
+	size_t nameLen = 0;
+	std::string nameStorage;
+	const char* name = nameBuf;
+	if (napi_get_value_string_utf8(env, propertyName, nameBuf, sizeof(nameBuf), &nameLen) != napi_ok || nameLen >= sizeof(nameBuf) - 1) {
+		nameStorage = propertyName;
+		name = nameStorage.c_str();
+		nameLen = nameStorage.size();
+	}
 
 	//Order of execution
 	//1.check for number and call set index handlers
 	//2.get any other property name from the instance
 
 	//do not assign empty property name. myarray[''] = 42; is valid in JS
-	if (propertyText.length() == 0) {
+	if (nameLen == 0) {
 		throw Napi::Error::New(env, "Invalid number ''");
 	}
 
 	//1.Check property is number and call set index handler
-	char firstChar = *propertyText.c_str();
+	char firstChar = *name;
 	bool isNumber = isdigit(firstChar) || firstChar == '+' || firstChar == '-';
 	if (isNumber) {
+		std::string propertyText(name, nameLen);
 		try {
 			realm::js::validated_positive_index(propertyText);
 		}
@@ -761,7 +906,7 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::set_proxy_trap(const Napi::C
 	catch (const Napi::Error & e) {
 		Napi::Boolean readOnly = e.Get("readOnly").As<Napi::Boolean>();
 		if (!readOnly.IsUndefined() && readOnly) {
-			std::string message = "Cannot assign to read only property '" + propertyText + "'";
+			std::string message = "Cannot assign to read only property '" + std::string(name, nameLen) + "'";
 			throw Napi::Error::New(env, message);
 		}
 
@@ -900,7 +1045,7 @@ Napi::Value ObjectWrap<ClassType>::property_getter(const Napi::CallbackInfo& inf
 	auto& s_class = get_class();
 	try {
 		auto propertyName = (node::String*)info.Data();
-		return s_class.string_accessor.getter(info, info.This().As<Napi::Object>(), propertyName->ToString(env));
+		return s_class.string_accessor.getter(info, info.This().As<Napi::Object>(), *propertyName);
 	}
 	catch (const Napi::Error & e) {
 		e.ThrowAsJavaScriptException();
@@ -915,7 +1060,7 @@ void ObjectWrap<ClassType>::property_setter(const Napi::CallbackInfo& info) {
 	try {
 		auto propertyName = (node::String*)info.Data();
 		auto value = info[0];
-		s_class.string_accessor.setter(info, info.This().As<Napi::Object>(), propertyName->ToString(env), value);
+		s_class.string_accessor.setter(info, info.This().As<Napi::Object>(), *propertyName, value);
 	}
 	catch (const Napi::Error & e) {
 		e.ThrowAsJavaScriptException();
@@ -989,7 +1134,10 @@ Napi::Function ObjectWrap<ClassType>::init_class(Napi::Env env) {
 	bool has_index_accessor = (s_class.index_accessor.getter || s_class.index_accessor.setter);
 	const IndexPropertyType* index_accessor = has_index_accessor ? &s_class.index_accessor : nullptr;
 
-	ctor = WrappedObject<ClassType>::init(env, s_class.name, &ObjectWrap<ClassType>::constructor_callback, &ObjectWrap<ClassType>::has_native_method, properties, index_accessor);
+	std::vector<std::string> nativeMethods;
+	collect_native_methods(nativeMethods);
+
+	ctor = WrappedObject<ClassType>::init(env, s_class.name, &ObjectWrap<ClassType>::constructor_callback, std::move(nativeMethods), properties, index_accessor);
 
 	auto ctorPrototypeProperty = ctor.Get("prototype");
 	if (ctorPrototypeProperty.IsUndefined()) {
@@ -1047,6 +1195,11 @@ Napi::Object ObjectWrap<ClassType>::create_instance(Napi::Env env, Internal* int
 		throw Napi::Error::New(env, "RealmObjectClass requires an internal realm object when creating instances");
 	}
 
+	//initialize the class on demand. Classes exposed through lazy accessors may need instances before their constructor property is ever read
+	if (WrappedObject<ClassType>::get_constructor(env).IsNull()) {
+		create_constructor(env);
+	}
+
 	Napi::Object factory = WrappedObject<ClassType>::create_instance(env, internal);
     return scope.Escape(factory).As<Napi::Object>();
 }
@@ -1115,27 +1268,29 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
 	}
 
 	Napi::Object instance;
-	auto config = internal->realm()->config();
-	std::string path = config.path;
+	//avoid copying the whole Realm::Config per created wrapper; only the path is needed for the cache key
+	const std::string& path = internal->realm()->config().path;
 	auto version = internal->realm()->schema_version();
-	std::string schemaName = schema.name + ":" + std::to_string(version); 
+	std::string schemaName = schema.name + ":" + std::to_string(version);
 
 	std::unordered_map<std::string, SchemaObjectType*>* schemaObjects = nullptr;
-	if (!s_schemaObjectTypes.count(path)) {
+	auto schemaObjectsIt = s_schemaObjectTypes.find(path);
+	if (schemaObjectsIt == s_schemaObjectTypes.end()) {
 		//std::map<std::string, std::map<std::string, SchemaObjectType*>>
 		schemaObjects = new std::unordered_map<std::string, SchemaObjectType*>();
 		s_schemaObjectTypes.emplace(path, schemaObjects);
 	}
 	else {
-		schemaObjects = s_schemaObjectTypes.at(path);
+		schemaObjects = schemaObjectsIt->second;
 	}
 
 	Napi::Function schemaObjectConstructor;
 	Napi::Symbol externalSymbol = ExternalSymbol;
 	//if we are creating a RealmObject from schema with no user defined constructor
 	if (constructor.IsEmpty()) {
-		//1.Check by name if the constructor is already created for this RealmObject 
-		if (!schemaObjects->count(schemaName)) {
+		//1.Check by name if the constructor is already created for this RealmObject
+		auto schemaObjectTypeIt = schemaObjects->find(schemaName);
+		if (schemaObjectTypeIt == schemaObjects->end()) {
 
 			//2.Create the constructor
 
@@ -1163,8 +1318,7 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
 		}
 		else {
 			//hot path. The constructor for this schema object is already cached. use it and return a new instance
-			SchemaObjectType* schemaObjectType = schemaObjects->at(schemaName);
-			schemaObjectConstructor = schemaObjectType->constructor.Value();
+			schemaObjectConstructor = schemaObjectTypeIt->second->constructor.Value();
 		}
 
 		Napi::External<Internal> externalValue = Napi::External<Internal>::New(env, internal, internal_finalizer);
@@ -1174,12 +1328,13 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
 	else {
 		//creating a RealmObject with user defined constructor
 
-		bool schemaExists = schemaObjects->count(schemaName);
+		auto schemaObjectTypeIt = schemaObjects->find(schemaName);
+		bool schemaExists = schemaObjectTypeIt != schemaObjects->end();
 		SchemaObjectType* schemaObjectType;
 		if (schemaExists) {
-			schemaObjectType = schemaObjects->at(schemaName);
+			schemaObjectType = schemaObjectTypeIt->second;
 			schemaObjectConstructor = schemaObjectType->constructor.Value();
-			
+
 			//check if constructors have changed for the same schema object and name
 			if (!schemaObjectConstructor.StrictEquals(constructor)) {
 				schemaExists = false;
@@ -1189,9 +1344,6 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
 
 		//hot path. The constructor for this schema object is already cached. use it and return a new instance
 		if (schemaExists) {
-			schemaObjectType = schemaObjects->at(schemaName);
-			schemaObjectConstructor = schemaObjectType->constructor.Value();
-
 			instance = schemaObjectConstructor.New({});
 
 			Napi::External<Internal> externalValue = Napi::External<Internal>::New(env, internal, internal_finalizer);
@@ -1273,6 +1425,11 @@ inline void ObjectWrap<ClassType>::on_context_destroy(Napi::Env env, std::string
 
 template<typename ClassType>
 inline bool ObjectWrap<ClassType>::is_instance(Napi::Env env, const Napi::Object& object) {
+	//initialize the class on demand, same as create_instance, so instance checks work before the lazy constructor property is read
+	if (WrappedObject<ClassType>::get_constructor(env).IsNull()) {
+		create_constructor(env);
+	}
+
 	return WrappedObject<ClassType>::is_instance(env, object);
 }
 
@@ -1312,8 +1469,8 @@ Napi::Value ObjectWrap<ClassType>::constructor_callback(const Napi::CallbackInfo
 	auto& s_class = get_class();
 
 	if (reinterpret_cast<void*>(s_class.constructor) != nullptr) {
-		auto arguments = get_arguments(info);
-		node::Arguments args { env, arguments.size(), arguments.data() };
+		ArgumentsBuffer arguments(info);
+		node::Arguments args { env, arguments.count(), arguments.data() };
 		s_class.constructor(env, info.This().As<Napi::Object>(), args);
 		return scope.Escape(env.Null()); //return a value to comply with Napi::FunctionCallback
 	}
@@ -1337,6 +1494,19 @@ bool ObjectWrap<ClassType>::has_native_method(const std::string& name) {
 	return ObjectWrap<ParentClassType>::has_native_method(name);
 }
 
+//Collects the method names from this class definition and its parents. Used to build the flattened,
+//sorted matcher handed to WrappedObject::init. Reads the class definitions directly instead of the
+//s_nativeMethods sets so it does not depend on the parent classes being initialized yet
+template<typename ClassType>
+void ObjectWrap<ClassType>::collect_native_methods(std::vector<std::string>& names) {
+	auto& s_class = get_class();
+	for (auto& pair : s_class.methods) {
+		names.push_back(pair.first);
+	}
+
+	ObjectWrap<ParentClassType>::collect_native_methods(names);
+}
+
 template<typename ClassType>
 Napi::ClassPropertyDescriptor<WrappedObject<ClassType>> ObjectWrap<ClassType>::setup_method(Napi::Env env, const std::string& name, node::Types::FunctionCallback callback) {
 	auto& s_nativeMethods = get_nativeMethods();
@@ -1401,8 +1571,8 @@ catch (const std::exception & e) {\
 template<node::ArgumentsMethodType F>
 Napi::Value wrap(const Napi::CallbackInfo& info) {
 	Napi::Env env = info.Env();
-	auto arguments = node::get_arguments(info);
-	node::Arguments args{ info.Env(), arguments.size(), arguments.data() };
+	node::ArgumentsBuffer arguments(info);
+	node::Arguments args{ info.Env(), arguments.count(), arguments.data() };
 	node::ReturnValue result(env);
 
 	Napi::Object instanceProxy = info.This().As<Napi::Object>().Get("_instanceProxy").As<Napi::Object>();
@@ -1471,7 +1641,7 @@ Napi::Value wrap(const Napi::CallbackInfo& info, const Napi::Object& instance, u
 }
 
 template<node::StringPropertyType::GetterType F>
-Napi::Value wrap(const Napi::CallbackInfo& info, const Napi::Object& instance, const Napi::String& property) {
+Napi::Value wrap(const Napi::CallbackInfo& info, const Napi::Object& instance, const node::String& property) {
 	Napi::Env env = info.Env();
 	node::ReturnValue result(env);
 
@@ -1483,7 +1653,7 @@ Napi::Value wrap(const Napi::CallbackInfo& info, const Napi::Object& instance, c
 }
 
 template<node::StringPropertyType::SetterType F>
-Napi::Value wrap(const Napi::CallbackInfo& info, const Napi::Object& instance, const Napi::String& property, const Napi::Value& value) {
+Napi::Value wrap(const Napi::CallbackInfo& info, const Napi::Object& instance, const node::String& property, const Napi::Value& value) {
 	Napi::Env env = info.Env();
 	try {
 		bool success = F(env, instance, property, value);
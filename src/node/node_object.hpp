@@ -63,6 +63,16 @@ inline Napi::Value node::Object::get_property(Napi::Env env, const Napi::Object&
 	}
 }
 
+template<>
+inline Napi::Value node::Object::get_property(Napi::Env env, const Napi::Object& object, const Napi::Value& key) {
+	try {
+		return object.Get(key);
+	}
+	catch (const Napi::Error& e) {
+		throw node::Exception(env, e.Message());
+	}
+}
+
 template<>
 inline Napi::Value node::Object::get_property(Napi::Env env, const Napi::Object& object, uint32_t index) {
 	try {
@@ -103,6 +113,41 @@ inline void node::Object::set_property(Napi::Env env, Napi::Object& object, uint
 	}
 }
 
+struct LazyPropertyState {
+	std::string name;
+	Napi::Value (*factory)(Napi::Env);
+};
+
+static inline Napi::Value lazy_property_getter(const Napi::CallbackInfo& info) {
+	Napi::Env env = info.Env();
+	LazyPropertyState* state = (LazyPropertyState*)info.Data();
+
+	Napi::Value value = state->factory(env);
+
+	//replace the accessor with the created value so subsequent reads are plain property hits
+	Napi::Object thisObject = info.This().As<Napi::Object>();
+	thisObject.DefineProperty(Napi::PropertyDescriptor::Value(state->name, value, napi_default));
+	return value;
+}
+
+template<>
+inline void node::Object::set_lazy_property(Napi::Env env, const Napi::Object& object, const node::String& key, Napi::Value (*factory)(Napi::Env)) {
+	try {
+		Napi::Object obj = object;
+		std::string name = key;
+
+		//the state is kept alive for the process lifetime, like the cached property names
+		LazyPropertyState* state = new LazyPropertyState{ name, factory };
+
+		//the accessor must stay configurable so the getter can redefine the property with the created value
+		auto propDescriptor = Napi::PropertyDescriptor::Accessor<lazy_property_getter>(Napi::String::New(env, name), napi_configurable, (void*)state);
+		obj.DefineProperty(propDescriptor);
+	}
+	catch (const Napi::Error& e) {
+		throw node::Exception(env, e.Message());
+	}
+}
+
 template<>
 inline std::vector<node::String> node::Object::get_property_names(Napi::Env env, const Napi::Object& object) {
 	try {
@@ -150,15 +195,36 @@ inline Napi::Object node::Object::create_empty(Napi::Env env) {
 
 template<>
 inline Napi::Object node::Object::create_array(Napi::Env env, uint32_t length, const Napi::Value values[]) {
+	// Freshly created array, known length: write elements through
+	// napi_set_element directly instead of set_property's per-element
+	// try/catch and wrapper call. Large slice()/toJSON() results hit this
+	// loop tens of thousands of times.
 	Napi::Array array = Napi::Array::New(env, length);
-    for (uint32_t i = 0; i < length; i++) {
-        set_property(env, array, i, values[i]);
-    }
-    return array;
+	for (uint32_t i = 0; i < length; i++) {
+		if (napi_set_element(env, array, i, values[i]) != napi_ok) {
+			throw node::Exception(env, "Failed to set array element");
+		}
+	}
+	return array;
 }
 
 template<>
 inline Napi::Object node::Object::create_date(Napi::Env env, double time) {
+//if rebuilding the binary on Node.js with NAPI 4. On CI we should always be building with Node.js NAPI 5
+#if NAPI_VERSION >= 5
+	uint32_t version;
+	napi_status status = napi_get_version(env, &version);
+	NAPI_THROW_IF_FAILED(env, status, Napi::Object());
+	if (version >= 5) {
+		// Creating the date directly skips the global Date constructor lookup
+		// and the generic construct machinery for every boxed Timestamp.
+		napi_value date;
+		status = napi_create_date(env, time, &date);
+		NAPI_THROW_IF_FAILED(env, status, Napi::Object());
+		return Napi::Object(env, date);
+	}
+#endif
+
 	Napi::Function date_constructor = env.Global().Get("Date").As<Napi::Function>();
 	Napi::Number value = Napi::Number::New(env, time);
 	return date_constructor.New({ value });
@@ -19,10 +19,31 @@
 #pragma once
 
 #include "node_types.hpp"
+#include "metrics.hpp"
+
+#include <utility>
+#include <vector>
 
 namespace realm {
 namespace node {
 
+//napi references cannot be re-pointed at a new value, so released references can't be pooled for
+//reuse. Instead, references whose count dropped to zero are queued here and deleted in batches
+//from the JS thread, so listener churn doesn't pay a napi_delete_reference round-trip per handle.
+static std::vector<std::pair<napi_env, napi_ref>> pendingReferenceDeletes;
+
+static inline void queue_reference_delete(napi_env env, napi_ref ref) {
+	constexpr size_t batch_size = 128;
+
+	pendingReferenceDeletes.emplace_back(env, ref);
+	if (pendingReferenceDeletes.size() >= batch_size) {
+		for (auto& pending : pendingReferenceDeletes) {
+			napi_delete_reference(pending.first, pending.second);
+		}
+		pendingReferenceDeletes.clear();
+	}
+}
+
 template<typename MemberType>
 class Protected {
 protected:
@@ -45,6 +66,7 @@ public:
 		if (status != napi_ok) {
 			throw std::runtime_error(util::format("Can't create protected reference: napi_status %1", status));
 		}
+		js::metrics::s_live_protected_refs.fetch_add(1, std::memory_order_relaxed);
 	}
 
 	Protected(const Protected& other) : m_env(other.m_env), m_ref(other.m_ref), m_isValue(other.m_isValue) {
@@ -53,6 +75,7 @@ public:
 		if (status != napi_ok) {
 			throw std::runtime_error(util::format("Can't increase protected reference count: napi_status %1", status));
 		}
+		js::metrics::s_live_protected_refs.fetch_add(1, std::memory_order_relaxed);
 	}
 
 	Protected(Protected&& other) : Protected() {
@@ -73,7 +96,13 @@ public:
 	}
 
 	~Protected() {
-		if (m_ref == nullptr || m_suppressDestruct) {
+		if (m_ref == nullptr) {
+			return;
+		}
+		//decremented even when destruction is suppressed: the counter tracks live Protected
+		//handles, and this one is gone either way
+		js::metrics::s_live_protected_refs.fetch_sub(1, std::memory_order_relaxed);
+		if (m_suppressDestruct) {
 			return;
 		}
 
@@ -83,8 +112,8 @@ public:
 			REALM_ASSERT((status == napi_ok) && "~Protected: Can't decrease protected reference count");
 
 			if (result == 0) {
-				napi_status status = napi_delete_reference(m_env, m_ref);
-				REALM_ASSERT((status == napi_ok) && "~Protected: Can't unallocate protected reference");
+				//at count zero the value is already collectable; the reference itself is deleted in a batch
+				queue_reference_delete(m_env, m_ref);
 			}
 
 			m_ref = nullptr;
@@ -200,5 +229,58 @@ class Protected<node::Types::Function> : public node::Protected<Napi::Function>
     Protected(Napi::Env env, Napi::Function function) : node::Protected<Napi::Function>(env, function) {}
 };
 
+template<>
+class WeakObjectReference<node::Types::Object> {
+  public:
+	WeakObjectReference() = default;
+
+	WeakObjectReference(Napi::Env env, Napi::Object object) : m_env(env) {
+		napi_status status = napi_create_reference(env, object, 0, &m_ref);
+		if (status != napi_ok) {
+			throw std::runtime_error(util::format("Can't create weak reference: napi_status %1", status));
+		}
+	}
+
+	WeakObjectReference(const WeakObjectReference&) = delete;
+	WeakObjectReference& operator=(const WeakObjectReference&) = delete;
+
+	WeakObjectReference(WeakObjectReference&& other) : m_env(other.m_env), m_ref(other.m_ref) {
+		other.m_ref = nullptr;
+	}
+
+	WeakObjectReference& operator=(WeakObjectReference&& other) {
+		std::swap(m_env, other.m_env);
+		std::swap(m_ref, other.m_ref);
+		return *this;
+	}
+
+	~WeakObjectReference() {
+		if (m_ref != nullptr) {
+			napi_delete_reference(m_env, m_ref);
+		}
+	}
+
+	explicit operator bool() const {
+		return peek() != nullptr;
+	}
+
+	Napi::Object get() const {
+		return Napi::Object(m_env, peek());
+	}
+
+  private:
+	napi_value peek() const {
+		if (m_ref == nullptr) {
+			return nullptr;
+		}
+		napi_value value = nullptr;
+		napi_get_reference_value(m_env, m_ref, &value);
+		return value;
+	}
+
+	Napi::Env m_env{nullptr};
+	napi_ref m_ref = nullptr;
+};
+
 } // js
 } // realm
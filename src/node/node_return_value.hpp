@@ -43,7 +43,8 @@ class ReturnValue<node::Types> {
 	}
 
     void set(const Napi::Value &value) {
-        m_value = Napi::Value(m_env, value);
+        //assign the handle directly; re-wrapping it would construct another Napi::Value for no gain
+        m_value = value;
     }
 
     void set(const std::string &string) {
@@ -75,7 +76,7 @@ class ReturnValue<node::Types> {
 		m_value = Napi::Value::From(m_env, number);
     }
 
-    void set(realm::Mixed mixed) {
+    void set(const realm::Mixed& mixed) {
 		m_value = Value<node::Types>::from_mixed(m_env, nullptr, mixed);
     }
 
@@ -89,7 +90,7 @@ class ReturnValue<node::Types> {
     }
 
     template<typename T>
-    void set(util::Optional<T> value) {
+    void set(const util::Optional<T>& value) {
         if (value) {
             set(*value);
         }
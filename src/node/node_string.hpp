@@ -33,7 +33,9 @@ class String<node::Types> {
 
   public:
     static bson::Bson to_bson(StringType stringified_ejson) {
-        return bson::parse(std::string(stringified_ejson));
+        // Moving into the parse avoids duplicating the payload; callFunction
+        // arguments routinely run to many KB of EJSON.
+        return bson::parse(std::string(std::move(stringified_ejson)));
     }
 
     static std::string from_bson(const bson::Bson& bson) {
@@ -49,8 +49,12 @@ struct Types {
 	typedef Napi::Value(*NapiPropertyGetterCallback)(const Napi::CallbackInfo& info);
 	typedef void(*NapiPropertySetterCallback)(const Napi::CallbackInfo& info, const Napi::Value& value);
 
-	typedef Napi::Value(*NapiStringPropertyGetterCallback)(const Napi::CallbackInfo& info, const Napi::Object& instance, const Napi::String& property);
-	typedef Napi::Value(*NapiStringPropertySetterCallback)(const Napi::CallbackInfo& info, const Napi::Object& instance, const Napi::String& property, const Napi::Value& value);
+	// The property name is the already-decoded string the accessor callbacks
+	// hold interned (see propertyNamesCache): passing it through directly
+	// avoids an encode to Napi::String followed by an immediate decode back
+	// to UTF-8 on every schema property access.
+	typedef Napi::Value(*NapiStringPropertyGetterCallback)(const Napi::CallbackInfo& info, const Napi::Object& instance, const js::String<Types>& property);
+	typedef Napi::Value(*NapiStringPropertySetterCallback)(const Napi::CallbackInfo& info, const Napi::Object& instance, const js::String<Types>& property, const Napi::Value& value);
 	typedef Napi::Value(*NapiStringPropertyEnumeratorCallback)(const Napi::CallbackInfo& info, const Napi::Object& instance);
 
 	using ConstructorCallback = NapiFunctionCallback;
@@ -174,6 +174,15 @@ inline Napi::Value node::Value::from_number(Napi::Env env, double number) {
 	return Napi::Number::New(env, number);
 }
 
+template<>
+inline Napi::Value node::Value::from_integer(Napi::Env env, int64_t number) {
+	napi_value value;
+	if (napi_create_int64(env, number, &value) == napi_ok) {
+		return Napi::Value(env, value);
+	}
+	return Napi::Number::New(env, double(number));
+}
+
 template<>
 inline Napi::Value node::Value::from_nonnull_string(Napi::Env env, const node::String& string) {
 	return Napi::String::New(env, string);
@@ -192,6 +201,22 @@ inline Napi::Value node::Value::from_nonnull_binary(Napi::Env env, BinaryData da
 	return scope.Escape(buffer);
 }
 
+template<>
+inline Napi::Value node::Value::from_external_binary(Napi::Env env, std::string&& data) {
+	Napi::EscapableHandleScope scope(env);
+
+	// The ArrayBuffer adopts the string's heap allocation; the finalizer frees
+	// it when the buffer is garbage collected.
+	auto heap_data = std::make_unique<std::string>(std::move(data));
+	Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(env, heap_data->empty() ? nullptr : &(*heap_data)[0], heap_data->size(),
+		[](Napi::Env, void*, std::string* hint) {
+			delete hint;
+		}, heap_data.get());
+	heap_data.release();
+
+	return scope.Escape(buffer);
+}
+
 template<>
 inline Napi::Value node::Value::from_undefined(Napi::Env env) {
 	return Napi::Value(env, env.Undefined());
@@ -217,6 +242,19 @@ inline double node::Value::to_number(Napi::Env env, const Napi::Value& value) {
 	return number;
 }
 
+template<>
+inline int64_t node::Value::to_integer(Napi::Env env, const Napi::Value& value) {
+	// Actual numbers skip the ToNumber coercion call; NaN and non-number
+	// values fall through to the validating double path.
+	if (value.IsNumber()) {
+		double number = value.As<Napi::Number>().DoubleValue();
+		if (!std::isnan(number)) {
+			return int64_t(number);
+		}
+	}
+	return int64_t(to_number(env, value));
+}
+
 template<>
 inline OwnedBinaryData node::Value::to_binary(Napi::Env env, const Napi::Value& value) {
 
@@ -245,6 +283,35 @@ inline OwnedBinaryData node::Value::to_binary(Napi::Env env, const Napi::Value&
     return node_binary->create_binary_blob();
 }
 
+template<>
+inline BinaryData node::Value::to_binary_view(Napi::Env env, const Napi::Value& value) {
+
+    if(value.IsBuffer()) {
+        auto buffer = value.As<Napi::Buffer<char>>();
+        return buffer.Length() ? BinaryData(buffer.Data(), buffer.Length()) : BinaryData("", 0);
+    }
+    if(value.IsDataView()) {
+        auto data_view = value.As<Napi::DataView>();
+        if (data_view.ByteLength() == 0) {
+            return BinaryData("", 0);
+        }
+        return BinaryData(static_cast<const char*>(data_view.ArrayBuffer().Data()) + data_view.ByteOffset(), data_view.ByteLength());
+    }
+    if(value.IsTypedArray()) {
+        auto typed_array = value.As<Napi::TypedArray>();
+        if (typed_array.ByteLength() == 0) {
+            return BinaryData("", 0);
+        }
+        return BinaryData(static_cast<const char*>(typed_array.ArrayBuffer().Data()) + typed_array.ByteOffset(), typed_array.ByteLength());
+    }
+    if(value.IsArrayBuffer()) {
+        auto array_buffer = value.As<Napi::ArrayBuffer>();
+        return array_buffer.ByteLength() ? BinaryData(static_cast<const char*>(array_buffer.Data()), array_buffer.ByteLength()) : BinaryData("", 0);
+    }
+
+    return BinaryData();
+}
+
 
 template<>
 inline Napi::Object node::Value::to_object(Napi::Env env, const Napi::Value& value) {
@@ -277,6 +344,19 @@ inline Napi::Object node::Value::to_date(Napi::Env env, const Napi::Value& value
 	return to_object(env, value);
 }
 
+// The BSON wrapper constructors hang off the Realm constructor and never
+// change after the module loads, so resolve each of them once instead of
+// walking the property chain on every boxed value. The binding already
+// assumes a single environment (see RealmClassConstructor).
+inline Napi::Function node_cached_bson_constructor(Napi::FunctionReference& cache, const char* name) {
+	if (cache.IsEmpty()) {
+		Napi::Function realm_constructor = node::RealmClassConstructor.Value();
+		cache = Napi::Persistent(realm_constructor.Get(name).As<Napi::Function>());
+		cache.SuppressDestruct();
+	}
+	return cache.Value();
+}
+
 template<>
 inline Napi::Value node::Value::from_decimal128(Napi::Env env, const Decimal128& number) {
 	Napi::EscapableHandleScope scope(env);
@@ -285,11 +365,15 @@ inline Napi::Value node::Value::from_decimal128(Napi::Env env, const Decimal128&
 		return scope.Escape(Napi::Value(env, env.Null()));
 	}
 
-	Napi::Function realm_constructor = node::RealmClassConstructor.Value();
-	Napi::Object decimal_constructor = realm_constructor.Get("_Decimal128").As<Napi::Object>();
-	Napi::Function fromStringFunc = decimal_constructor.Get("fromString").As<Napi::Function>();
+	static Napi::FunctionReference s_from_string;
+	if (s_from_string.IsEmpty()) {
+		Napi::Function realm_constructor = node::RealmClassConstructor.Value();
+		Napi::Object decimal_constructor = realm_constructor.Get("_Decimal128").As<Napi::Object>();
+		s_from_string = Napi::Persistent(decimal_constructor.Get("fromString").As<Napi::Function>());
+		s_from_string.SuppressDestruct();
+	}
 	Napi::String numberAsString = Napi::String::New(env, number.to_string());
-	Napi::Value result = fromStringFunc.Call({ numberAsString });
+	Napi::Value result = s_from_string.Value().Call({ numberAsString });
 
 	return scope.Escape(result);
 }
@@ -310,9 +394,12 @@ template<>
 inline Napi::Value node::Value::from_object_id(Napi::Env env, const ObjectId& objectId) {
 	Napi::EscapableHandleScope scope(env);
 
-	Napi::Function realm_constructor = node::RealmClassConstructor.Value();
-	Napi::Function object_id_constructor = realm_constructor.Get("_ObjectId").As<Napi::Function>();
-	napi_value args[] = { Napi::String::New(env, objectId.to_string()) };
+	static Napi::FunctionReference s_constructor;
+	Napi::Function object_id_constructor = node_cached_bson_constructor(s_constructor, "_ObjectId");
+	// The bson ObjectId constructor accepts the raw 12-byte payload, which
+	// skips both the hex encode here and the decode inside the constructor.
+	auto bytes = objectId.to_bytes();
+	napi_value args[] = { Napi::Buffer<std::uint8_t>::Copy(env, bytes.data(), bytes.size()) };
 	Napi::Value result = object_id_constructor.New(1, args);
 	return scope.Escape(result);
 }
@@ -333,8 +420,8 @@ template<>
 Napi::Value node::Value::from_uuid(Napi::Env env, const UUID& uuid) {
 	Napi::EscapableHandleScope scope(env);
 
-	Napi::Function realm_constructor = node::RealmClassConstructor.Value();
-	Napi::Function uuid_constructor = realm_constructor.Get("_UUID").As<Napi::Function>();
+	static Napi::FunctionReference s_constructor;
+	Napi::Function uuid_constructor = node_cached_bson_constructor(s_constructor, "_UUID");
 
 	napi_value args[] = { Napi::Buffer<std::uint8_t>::Copy(env, uuid.to_bytes().data(), UUID::num_bytes) };
 	Napi::Value result = uuid_constructor.New(1, args);
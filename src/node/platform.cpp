@@ -16,6 +16,8 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
+#include <mutex>
+#include <set>
 #include <stdexcept>
 #include <vector>
 #include <stdarg.h>
@@ -45,6 +47,9 @@ struct FileSystemRequest : uv_fs_t {
 // taken from Node.js: function Cwd in node.cc
 std::string default_realm_file_directory()
 {
+    // Resolved once per process; every Realm open funnels through here and
+    // the working directory is not expected to change underneath us.
+    static const std::string s_directory = [] {
 #ifdef _WIN32
   /* MAX_PATH is in characters, not bytes. Make sure we have enough headroom. */
   char buf[MAX_PATH * 4];
@@ -52,17 +57,32 @@ std::string default_realm_file_directory()
   char buf[PATH_MAX];
 #endif
 
-    size_t cwd_len = sizeof(buf);
-    int err = uv_cwd(buf, &cwd_len);
-    if (err) {
-        throw UVException(static_cast<uv_errno_t>(err));
-    }
+        size_t cwd_len = sizeof(buf);
+        int err = uv_cwd(buf, &cwd_len);
+        if (err) {
+            throw UVException(static_cast<uv_errno_t>(err));
+        }
 
-    return std::string(buf, cwd_len);
+        return std::string(buf, cwd_len);
+    }();
+    return s_directory;
 }
 
 void ensure_directory_exists_for_file(const std::string &file_path)
 {
+    // Remember directories already ensured so that opening many Realms under
+    // the same directory walks the mkdir chain only once per process.
+    static std::mutex s_mutex;
+    static std::set<std::string> s_ensured;
+
+    std::string parent = file_path.substr(0, file_path.find_last_of('/') + 1);
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (s_ensured.count(parent)) {
+            return;
+        }
+    }
+
     size_t pos = 0;
 
     while ((pos = file_path.find_first_of('/', pos)) != std::string::npos) {
@@ -78,6 +98,9 @@ void ensure_directory_exists_for_file(const std::string &file_path)
             throw UVException(static_cast<uv_errno_t>(req.result));
         }
     }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_ensured.insert(std::move(parent));
 }
 
 void copy_bundled_realm_files()
@@ -85,6 +108,11 @@ void copy_bundled_realm_files()
     throw std::runtime_error("Realm for Node does not support this method.");
 }
 
+void copy_bundled_realm_files_with_progress(const CopyProgressHandler&)
+{
+    throw std::runtime_error("Realm for Node does not support this method.");
+}
+
 inline bool ends_with(const std::string& str, const std::string& suffix) {
     return str.size() > suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
 }
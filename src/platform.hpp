@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
 
 namespace realm {
@@ -38,6 +40,14 @@ void ensure_directory_exists_for_file(const std::string &file);
 // copy all realm files from resources directory to default realm dir
 void copy_bundled_realm_files();
 
+// per-file byte progress during copy_bundled_realm_files_with_progress
+using CopyProgressHandler = std::function<void(uint64_t copied_bytes, uint64_t total_bytes)>;
+
+// like copy_bundled_realm_files, with a kernel-space copy where the platform
+// supports it and optional progress reporting; pass nullptr for no progress.
+// Safe to call off the JS thread.
+void copy_bundled_realm_files_with_progress(const CopyProgressHandler& progress);
+
 // remove all realm files in the given directory
 void remove_realm_files_from_directory(const std::string &directory);
 
@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// Microbenchmarks over the binding hot paths, driving JavaScriptCore
+// directly like the tests in main.cpp (see README.md). Built as the
+// realm-js-benchmarks target; run with
+//
+//     realm-js-benchmarks [benchmark] --reporter xml --out baseline.xml
+//
+// to emit machine-readable results for baseline comparison across releases.
+
+#define CATCH_CONFIG_MAIN
+#include <string>
+
+#include "catch_amalgamated.hpp"
+#include "common/object/interfaces.hpp"
+#include "jsc/jsc_string.hpp"
+#include "bson_binary.hpp"
+#include "test_bed.hpp"
+
+using namespace realm;
+
+namespace {
+
+struct BenchCollection : public IOCollection {
+    realm::Mixed stored = realm::Mixed(1000.0);
+    realm::Mixed get(std::string) override { return stored; }
+    void set(std::string, realm::Mixed val) override { stored = val; }
+    void remove(std::string) override {}
+    bool contains(std::string) override { return true; }
+};
+
+struct BenchGetterSetter {
+    IOCollection* collection{nullptr};
+
+    BenchGetterSetter(IOCollection* _collection) : collection{_collection} {}
+
+    void set(accessor::Arguments args) {
+        collection->set("N", realm::Mixed(JSValueToNumber(args.context, args.value, nullptr)));
+    }
+
+    JSValueRef get(accessor::Arguments args) {
+        return JSValueMakeNumber(args.context, collection->get(args.property_name).get_double());
+    }
+};
+
+struct BenchObserver : public ObjectObserver {
+    IOCollection* get_collection() { return nullptr; }
+};
+
+// A representative callFunction argument payload.
+const std::string ejson_payload =
+    "[{\"_id\":{\"$oid\":\"60a1e2f3a4b5c6d7e8f90102\"},\"name\":\"benchmark\","
+    "\"value\":{\"$numberLong\":\"123456789\"},"
+    "\"nested\":{\"flag\":true,\"list\":[1,2,3.5,\"four\"]}}]";
+
+} // namespace
+
+TEST_CASE("Benchmark: value boxing and unboxing", "[benchmark]") {
+    JSC_VM jsc_vm;
+    auto ctx = jsc_vm.globalContext;
+
+    JSValueRef boxed_number = JSValueMakeNumber(ctx, 3.1415);
+    JSValueRef boxed_bool = JSValueMakeBoolean(ctx, true);
+
+    BENCHMARK("box double") { return JSValueMakeNumber(ctx, 3.1415); };
+    BENCHMARK("box bool") { return JSValueMakeBoolean(ctx, true); };
+    BENCHMARK("unbox double") { return JSValueToNumber(ctx, boxed_number, nullptr); };
+    BENCHMARK("unbox bool") { return JSValueToBoolean(ctx, boxed_bool); };
+}
+
+TEST_CASE("Benchmark: string conversion", "[benchmark]") {
+    const std::string property_value = "a reasonably long string property value";
+    js::String<jsc::Types> converted{property_value};
+
+    BENCHMARK("std::string -> JSStringRef") { return js::String<jsc::Types>(property_value); };
+    BENCHMARK("JSStringRef -> std::string") { return std::string(converted); };
+}
+
+TEST_CASE("Benchmark: dictionary access through IOCollection", "[benchmark]") {
+    JSC_VM jsc_vm;
+    auto ctx = jsc_vm.globalContext;
+
+    auto* dict = new common::JavascriptObject<BenchGetterSetter>{ctx};
+    BenchObserver* no_observer = nullptr;
+    dict->add_key("X");
+    dict->set_collection(new BenchCollection());
+    dict->set_observer(no_observer);
+    dict->finalize([=]() { delete dict; });
+    JSObjectRef object = dict->create();
+    jsc_vm.set_obj_prop("bench_dictionary", object);
+
+    JSStringRef key = jsc_vm.str("X");
+    JSValueRef value = JSValueMakeNumber(ctx, 42);
+
+    BENCHMARK("get through accessor") { return JSObjectGetProperty(ctx, object, key, nullptr); };
+    BENCHMARK("set through accessor") {
+        JSObjectSetProperty(ctx, object, key, value, kJSPropertyAttributeNone, nullptr);
+    };
+
+    BenchCollection raw;
+    BENCHMARK("raw IOCollection get") { return raw.get("X"); };
+    BENCHMARK("raw IOCollection set") { raw.set("X", realm::Mixed(7.0)); };
+}
+
+TEST_CASE("Benchmark: plain object creation", "[benchmark]") {
+    JSC_VM jsc_vm;
+    auto ctx = jsc_vm.globalContext;
+
+    const std::string key_names[] = {"a", "b", "c", "d", "e", "f", "g", "h"};
+    BenchObserver* no_observer = nullptr;
+
+    // The JSC analogue of create_instance_by_schema: build a JS object with
+    // one accessor per property plus a backing collection.
+    BENCHMARK("JavascriptObject with 8 accessors") {
+        auto* obj = new common::JavascriptObject<BenchGetterSetter>{ctx};
+        for (auto& name : key_names) {
+            obj->add_key(name);
+        }
+        obj->set_collection(new BenchCollection());
+        obj->set_observer(no_observer);
+        obj->finalize([=]() { delete obj; });
+        return obj->create();
+    };
+}
+
+TEST_CASE("Benchmark: EJSON parse and binary BSON codec", "[benchmark]") {
+    auto parsed = bson::parse(ejson_payload);
+    auto encoded = js::bson_binary::encode(parsed);
+
+    BENCHMARK("EJSON -> BSON (bson::parse)") { return bson::parse(ejson_payload); };
+    BENCHMARK("BSON -> EJSON string") { return parsed.to_string(); };
+    BENCHMARK("BSON -> binary") { return js::bson_binary::encode(parsed); };
+    BENCHMARK("binary -> BSON") { return js::bson_binary::decode(encoded.data(), encoded.size()); };
+}
@@ -111,6 +111,49 @@ struct T1 : public ObjectObserver {
     }
 };
 
+TEST_CASE("Testing NotificationBatcher coalescing") {
+    std::vector<int> order;
+
+    // No open batch: deliveries run immediately.
+    NotificationBatcher::enqueue([&] { order.push_back(1); });
+    REQUIRE(order == std::vector<int>{1});
+
+    order.clear();
+    {
+        NotificationBatcher::BatchGuard batch;
+        NotificationBatcher::enqueue([&] { order.push_back(1); });
+        NotificationBatcher::enqueue([&] {
+            order.push_back(2);
+            // Follow-up work enqueued during the flush still runs.
+            NotificationBatcher::enqueue([&] { order.push_back(3); });
+        });
+        {
+            // Nested guards defer the flush to the outermost scope.
+            NotificationBatcher::BatchGuard nested;
+            NotificationBatcher::enqueue([&] { order.push_back(4); });
+        }
+        REQUIRE(order.empty());
+    }
+    REQUIRE(order == std::vector<int>{1, 2, 4, 3});
+}
+
+TEST_CASE("Testing IOCollection batch defaults") {
+    MockedCollection collection{500};
+
+    realm::StringData keys[2] = {"a", "b"};
+    realm::Mixed out[2];
+    collection.get_many(keys, 2, out);
+
+    REQUIRE(out[0].get_double() == 500);
+    REQUIRE(out[1].get_double() == 500);
+
+    realm::Mixed values[2] = {realm::Mixed(10.0), realm::Mixed(20.0)};
+    collection.set_many(keys, values, 2);
+
+    // The defaults forward each entry to set(); the mock keeps the last value.
+    REQUIRE(collection.get("a").get_double() == 20);
+}
+
 TEST_CASE("Testing Logger#get_level") {
     REQUIRE(realm::common::logger::Logger::get_level("all") ==
             realm::common::logger::LoggerLevel::all);
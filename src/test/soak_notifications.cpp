@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// Soak benchmark for listener delivery latency under sustained write load.
+// Each simulated write batches one delivery per registered listener through
+// NotificationBatcher (the same coalescing layer production notifications
+// cross) and every delivery enters the JSC VM, so the measured write-to-
+// callback latency includes the VM entry cost. Results - p50/p99/p999
+// latency and queue depths - are written as JSON so notification-path
+// changes can land with numbers attached.
+//
+// The case is hidden from the default run; invoke it with
+//
+//     realm-js-benchmarks "[soak]"
+//
+// Tunables (environment): REALM_SOAK_SECONDS (default 5),
+// REALM_SOAK_LISTENERS (default 16), REALM_SOAK_OUT
+// (default soak_notifications.json).
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "catch_amalgamated.hpp"
+#include "common/object/observer.hpp"
+#include "test_bed.hpp"
+
+using namespace std::chrono;
+
+namespace {
+
+size_t env_or(const char* name, size_t fallback) {
+    if (const char* value = std::getenv(name)) {
+        return std::strtoull(value, nullptr, 10);
+    }
+    return fallback;
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    return sorted[size_t(p * double(sorted.size() - 1))];
+}
+
+} // namespace
+
+TEST_CASE("Soak: listener delivery latency under sustained writes", "[.][soak]") {
+    JSC_VM jsc_vm;
+    auto ctx = jsc_vm.globalContext;
+
+    // A minimal JS listener; entering the VM once per delivery is part of
+    // the cost being measured.
+    jsc_vm.vm("var soakCallbackRuns = 0; function soakCallback() { soakCallbackRuns++; }");
+    JSObjectRef callback = (JSObjectRef)JSObjectGetProperty(
+        ctx, jsc_vm.globalObject, jsc_vm.str("soakCallback"), nullptr);
+    REQUIRE(callback != nullptr);
+
+    const size_t listeners = env_or("REALM_SOAK_LISTENERS", 16);
+    const auto duration = seconds(env_or("REALM_SOAK_SECONDS", 5));
+
+    std::vector<double> latencies_us;
+    latencies_us.reserve(1 << 20);
+    size_t writes = 0;
+    size_t max_queue_depth = 0;
+    double queue_depth_sum = 0.0;
+
+    const auto deadline = steady_clock::now() + duration;
+    while (steady_clock::now() < deadline) {
+        const auto write_time = steady_clock::now();
+        {
+            NotificationBatcher::BatchGuard batch;
+            for (size_t i = 0; i < listeners; i++) {
+                NotificationBatcher::enqueue([&, write_time] {
+                    JSObjectCallAsFunction(ctx, callback, nullptr, 0, nullptr, nullptr);
+                    auto elapsed = steady_clock::now() - write_time;
+                    latencies_us.push_back(double(duration_cast<nanoseconds>(elapsed).count()) / 1000.0);
+                });
+            }
+            // Depth just before the guard unwinds and flushes: how far the
+            // queue got behind this write.
+            size_t depth = NotificationBatcher::pending_count();
+            max_queue_depth = std::max(max_queue_depth, depth);
+            queue_depth_sum += double(depth);
+        }
+        writes++;
+    }
+
+    REQUIRE(writes > 0);
+    REQUIRE(latencies_us.size() == writes * listeners);
+
+    std::sort(latencies_us.begin(), latencies_us.end());
+
+    const char* out_path = std::getenv("REALM_SOAK_OUT");
+    std::ofstream out(out_path ? out_path : "soak_notifications.json");
+    out << "{\n"
+        << "  \"listeners\": " << listeners << ",\n"
+        << "  \"writes\": " << writes << ",\n"
+        << "  \"deliveries\": " << latencies_us.size() << ",\n"
+        << "  \"latency_us\": {\n"
+        << "    \"p50\": " << percentile(latencies_us, 0.50) << ",\n"
+        << "    \"p99\": " << percentile(latencies_us, 0.99) << ",\n"
+        << "    \"p999\": " << percentile(latencies_us, 0.999) << ",\n"
+        << "    \"max\": " << latencies_us.back() << "\n"
+        << "  },\n"
+        << "  \"queue_depth\": {\n"
+        << "    \"mean\": " << (queue_depth_sum / double(writes)) << ",\n"
+        << "    \"max\": " << max_queue_depth << "\n"
+        << "  }\n"
+        << "}\n";
+    REQUIRE(out.good());
+}
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <realm/util/file.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace realm {
+namespace js {
+
+// Opt-in Chrome trace-event emission (the JSON format chrome://tracing and
+// the profiler frontends load), so native Realm activity - transactions,
+// notification delivery, sync callbacks - can be overlaid on the JS profiler
+// timeline. Start with Realm._startTrace(path), stop with Realm._stopTrace().
+//
+// Events are recorded as complete events (ph "X": timestamp plus duration),
+// which keeps recording to one entry per scope instead of begin/end pairs.
+// The hot side only captures a name pointer and two clock reads; formatting
+// and file writes happen on a background thread, FileLogSink-style.
+namespace tracing {
+
+static inline std::atomic<bool> s_enabled{false};
+
+class TraceFile {
+  public:
+    struct Event {
+        const char* name; // must point at a string literal
+        uint64_t ts_micros;
+        uint64_t dur_micros;
+        uint64_t tid;
+    };
+
+    void start(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_worker.joinable()) {
+            return; // already tracing
+        }
+        m_file.open(path, util::File::mode_Write);
+        m_file.write("[\n", 2);
+        m_stop = false;
+        m_worker = std::thread([this] { worker_loop(); });
+        s_enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void stop()
+    {
+        s_enabled.store(false, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_worker.joinable()) {
+                return;
+            }
+            m_stop = true;
+        }
+        m_condition.notify_one();
+        m_worker.join();
+        // Terminate the array; the trailing comma before this is accepted by
+        // every trace viewer, but the closing bracket keeps the file valid
+        // JSON for other tooling.
+        m_file.write("{}]\n", 4);
+        m_file.close();
+    }
+
+    void record(Event event)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_worker.joinable()) {
+                return; // stopped while the caller's scope was open
+            }
+            m_pending.push_back(event);
+        }
+        m_condition.notify_one();
+    }
+
+    static TraceFile& shared()
+    {
+        static TraceFile file;
+        return file;
+    }
+
+  private:
+    void worker_loop()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_stop || !m_pending.empty()) {
+            if (m_pending.empty()) {
+                m_condition.wait(lock, [this] { return m_stop || !m_pending.empty(); });
+                continue;
+            }
+
+            std::vector<Event> batch;
+            batch.swap(m_pending);
+            lock.unlock();
+            std::string chunk;
+            for (auto& event : batch) {
+                append_json(chunk, event);
+            }
+            m_file.write(chunk.data(), chunk.size());
+            lock.lock();
+        }
+    }
+
+    static void append_json(std::string& out, const Event& event)
+    {
+        out += "{\"name\":\"";
+        out += event.name;
+        out += "\",\"ph\":\"X\",\"cat\":\"realm\",\"pid\":1,\"tid\":";
+        out += std::to_string(event.tid);
+        out += ",\"ts\":";
+        out += std::to_string(event.ts_micros);
+        out += ",\"dur\":";
+        out += std::to_string(event.dur_micros);
+        out += "},\n";
+    }
+
+    util::File m_file;
+    std::thread m_worker;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<Event> m_pending;
+    bool m_stop = false;
+};
+
+inline uint64_t now_micros()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+
+// Emits one complete event covering the guarded scope. The name must be a
+// string literal; only the pointer is captured on the hot path.
+class ScopedTraceEvent {
+  public:
+    explicit ScopedTraceEvent(const char* name)
+        : m_name(name), m_armed(s_enabled.load(std::memory_order_relaxed))
+    {
+        if (m_armed) {
+            m_start = now_micros();
+        }
+    }
+
+    ~ScopedTraceEvent()
+    {
+        if (!m_armed) {
+            return;
+        }
+        uint64_t end = now_micros();
+        TraceFile::shared().record({m_name, m_start, end - m_start,
+                                    std::hash<std::thread::id>()(std::this_thread::get_id())});
+    }
+
+    ScopedTraceEvent(const ScopedTraceEvent&) = delete;
+    ScopedTraceEvent& operator=(const ScopedTraceEvent&) = delete;
+
+  private:
+    const char* m_name;
+    bool m_armed;
+    uint64_t m_start = 0;
+};
+
+} // namespace tracing
+} // namespace js
+} // namespace realm
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/object-store/util/scheduler.hpp>
+
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace realm {
+namespace js {
+
+// Scheduler for a Realm instance owned by a binding worker thread.
+//
+// A config copied from a JS-thread Realm still carries that thread's
+// event-loop scheduler, so a Realm the worker opens with it fails core's
+// thread-confinement checks on every access - and with caching enabled the
+// coordinator may even hand the worker the JS thread's live instance.
+// Constructed on the worker, this scheduler makes the worker the owning
+// thread. It cannot deliver notifications, which these short-lived worker
+// instances never need.
+class WorkerScheduler : public util::Scheduler {
+  public:
+    void notify() override {}
+    void set_notify_callback(std::function<void()>) override {}
+
+    bool is_on_thread() const noexcept override
+    {
+        return m_thread == std::this_thread::get_id();
+    }
+
+    bool is_same_as(const util::Scheduler* other) const noexcept override
+    {
+        return this == other;
+    }
+
+    bool can_deliver_notifications() const noexcept override
+    {
+        return false;
+    }
+
+    // Rebuild a config copied from another thread's Realm for use on the
+    // calling thread: install a scheduler owned by this thread and disable
+    // caching so the open can never alias another thread's instance.
+    static Realm::Config adopt(Realm::Config config)
+    {
+        config.scheduler = std::make_shared<WorkerScheduler>();
+        config.cache = false;
+        return config;
+    }
+
+  private:
+    std::thread::id const m_thread = std::this_thread::get_id();
+};
+
+} // namespace js
+} // namespace realm
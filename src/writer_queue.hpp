@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2021 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "concurrent_deque.hpp"
+#include "worker_scheduler.hpp"
+
+#include <realm/object-store/impl/object_accessor_impl.hpp>
+#include <realm/object-store/object_accessor.hpp>
+#include <realm/object-store/object_store.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/object-store/util/bson/bson.hpp>
+
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace realm {
+namespace js {
+
+// One native writer thread per Realm path, fed by a queue of data-described
+// write commands, backing realm._enqueueWrite(). The thread owns its own
+// Realm instance, so write-lock waits, the transaction itself and the
+// durability sync all happen off the JS thread - under multi-process
+// contention the event loop never blocks on the lock.
+//
+// Commands are BSON documents (the JS side submits EJSON, decoded on the JS
+// thread) rather than JS closures, since a closure could only run on the JS
+// thread. Supported shape:
+//
+//     { "create":    { "<class>": [ { ...properties... }, ... ] },
+//       "deleteAll": [ "<class>", ... ] }
+//
+// Each command is one transaction; completions fire on the JS thread via the
+// dispatcher the caller wraps them in.
+class WriterQueue {
+  public:
+    using Completion = std::function<void(std::exception_ptr)>;
+
+    explicit WriterQueue(Realm::Config config)
+        : m_config(std::move(config)),
+          m_worker([this] { worker_loop(); })
+    {
+    }
+
+    ~WriterQueue()
+    {
+        m_queue.push({bson::BsonDocument(), nullptr, true});
+        m_worker.join();
+    }
+
+    void enqueue(bson::BsonDocument command, Completion completion)
+    {
+        m_queue.push({std::move(command), std::move(completion), false});
+    }
+
+    // The queue for `config.path`, created (and its thread started) on first
+    // use. Queues live for the rest of the process so commands enqueued from
+    // any Realm instance on the path stay serialized.
+    static WriterQueue& for_path(const Realm::Config& config)
+    {
+        static std::mutex s_mutex;
+        static std::map<std::string, std::unique_ptr<WriterQueue>> s_queues;
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto& queue = s_queues[config.path];
+        if (!queue) {
+            queue = std::make_unique<WriterQueue>(config);
+        }
+        return *queue;
+    }
+
+  private:
+    struct Command {
+        bson::BsonDocument command;
+        Completion completion;
+        bool stop;
+    };
+
+    void worker_loop()
+    {
+        SharedRealm realm;
+        while (true) {
+            Command command = m_queue.pop();
+            if (command.stop) {
+                return;
+            }
+            std::exception_ptr error;
+            try {
+                if (!realm) {
+                    // Opened lazily so constructing the queue never races the
+                    // JS thread's own open of the same path. The snapshotted
+                    // config still carries the JS thread's scheduler, so it
+                    // is rebuilt here for the writer thread, which owns the
+                    // write transaction lifecycle.
+                    realm = Realm::get_shared_realm(WorkerScheduler::adopt(m_config));
+                }
+                apply(realm, command.command);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            if (command.completion) {
+                command.completion(error);
+            }
+        }
+    }
+
+    static void apply(const SharedRealm& realm, const bson::BsonDocument& command)
+    {
+        realm->begin_transaction();
+        try {
+            for (auto& entry : command) {
+                if (entry.first == "create") {
+                    CppContext context(realm);
+                    for (auto& by_class : entry.second.operator const bson::BsonDocument&()) {
+                        for (auto& object : by_class.second.operator const bson::BsonArray&()) {
+                            Object::create(context, realm, StringData(by_class.first),
+                                           bson_to_any(object));
+                        }
+                    }
+                }
+                else if (entry.first == "deleteAll") {
+                    for (auto& class_name : entry.second.operator const bson::BsonArray&()) {
+                        auto table = ObjectStore::table_for_object_type(
+                            realm->read_group(), static_cast<std::string>(class_name));
+                        if (!table) {
+                            throw std::runtime_error("Table does not exist. Object type: " +
+                                                     static_cast<std::string>(class_name));
+                        }
+                        table->clear();
+                    }
+                }
+                else {
+                    throw std::invalid_argument("Unknown writer-queue command: " + entry.first);
+                }
+            }
+        }
+        catch (...) {
+            realm->cancel_transaction();
+            throw;
+        }
+        realm->commit_transaction();
+    }
+
+    // EJSON gives every value an unambiguous type, so the mapping onto the
+    // util::Any types CppContext unboxes is exact - no schema lookup needed.
+    static util::Any bson_to_any(const bson::Bson& value)
+    {
+        using Type = bson::Bson::Type;
+        switch (value.type()) {
+            case Type::Null:
+                return util::Any();
+            case Type::Bool:
+                return util::Any(static_cast<bool>(value));
+            case Type::Int32:
+                return util::Any(static_cast<int64_t>(static_cast<int32_t>(value)));
+            case Type::Int64:
+                return util::Any(static_cast<int64_t>(value));
+            case Type::Double:
+                return util::Any(static_cast<double>(value));
+            case Type::String:
+                return util::Any(static_cast<std::string>(value));
+            case Type::Datetime:
+                return util::Any(static_cast<Timestamp>(value));
+            case Type::ObjectId:
+                return util::Any(static_cast<ObjectId>(value));
+            case Type::Decimal128:
+                return util::Any(static_cast<Decimal128>(value));
+            case Type::Uuid:
+                return util::Any(static_cast<UUID>(value));
+            case Type::Binary: {
+                auto& data = value.operator const std::vector<char>&();
+                return util::Any(std::string(data.data(), data.size()));
+            }
+            case Type::Document: {
+                AnyDict dict;
+                for (auto& entry : value.operator const bson::BsonDocument&()) {
+                    dict[entry.first] = bson_to_any(entry.second);
+                }
+                return util::Any(std::move(dict));
+            }
+            case Type::Array: {
+                AnyVector values;
+                for (auto& element : value.operator const bson::BsonArray&()) {
+                    values.push_back(bson_to_any(element));
+                }
+                return util::Any(std::move(values));
+            }
+            default:
+                throw std::invalid_argument("Unsupported value type in writer-queue command");
+        }
+    }
+
+    Realm::Config m_config;
+    ConcurrentMPSCQueue<Command> m_queue;
+    std::thread m_worker;
+};
+
+} // namespace js
+} // namespace realm
@@ -1894,4 +1894,75 @@ module.exports = {
       }, "Cannot create an object from a detached Realm.Object instance");
     });
   },
+
+  testListExtend: function () {
+    const realm = new Realm({ schema: [schemas.PersonObject, schemas.PersonList] });
+    let obj;
+
+    realm.write(() => {
+      obj = realm.create("PersonList", { list: [] });
+      const length = obj.list.extend([
+        { name: "Ari", age: 10 },
+        { name: "Tim", age: 11 },
+        { name: "Bjarne", age: 12 },
+      ]);
+      TestCase.assertEqual(length, 3);
+      TestCase.assertEqual(obj.list.length, 3);
+      TestCase.assertEqual(obj.list[2].name, "Bjarne");
+
+      TestCase.assertEqual(obj.list.extend([]), 3);
+    });
+
+    // Elements are validated before the first insert, so a bad element
+    // must not leave the list partially extended.
+    realm.write(() => {
+      TestCase.assertThrows(() => {
+        obj.list.extend([{ name: "Ann", age: 13 }, "not a person"]);
+      });
+      TestCase.assertEqual(obj.list.length, 3);
+    });
+
+    TestCase.assertThrows(() => {
+      obj.list.extend([{ name: "Ann", age: 13 }]);
+    }, "can only extend a list within a write transaction");
+
+    realm.close();
+  },
+
+  testListToTypedArray: function () {
+    const realm = new Realm({ schema: [schemas.PrimitiveArrays] });
+    let object;
+
+    realm.write(() => {
+      object = realm.create("PrimitiveArrays", {
+        int: [1, 2, 3],
+        float: [1.5, 2.5],
+        double: [0.25, 0.5],
+        string: ["a"],
+        optInt: [1, null],
+      });
+    });
+
+    const ints = object.int.toTypedArray();
+    TestCase.assertInstanceOf(ints, Float64Array);
+    TestCase.assertArraysEqual(Array.from(ints), [1, 2, 3]);
+
+    const floats = object.float.toTypedArray();
+    TestCase.assertInstanceOf(floats, Float32Array);
+    TestCase.assertEqual(floats.length, 2);
+    TestCase.assertEqualWithTolerance(floats[0], 1.5, 0.000001);
+
+    const doubles = object.double.toTypedArray();
+    TestCase.assertInstanceOf(doubles, Float64Array);
+    TestCase.assertEqual(doubles[1], 0.5);
+
+    TestCase.assertThrowsContaining(() => {
+      object.optInt.toTypedArray();
+    }, "not supported on optional lists");
+    TestCase.assertThrowsContaining(() => {
+      object.string.toTypedArray();
+    }, "only supported on int, float and double lists");
+
+    realm.close();
+  },
 };
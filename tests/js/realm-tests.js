@@ -2313,4 +2313,199 @@ module.exports = {
 
     realm.close();
   },
+
+  testRealmCreateAll: function () {
+    const realm = new Realm({ schema: [schemas.IntPrimary, schemas.TestObject] });
+
+    realm.write(() => {
+      const created = realm.createAll("TestObject", [{ doubleCol: 1 }, { doubleCol: 2 }, { doubleCol: 3 }]);
+      TestCase.assertEqual(created.length, 3);
+      TestCase.assertEqual(created[1].doubleCol, 2);
+    });
+    TestCase.assertEqual(realm.objects("TestObject").length, 3);
+
+    realm.write(() => {
+      realm.createAll("IntPrimaryObject", [
+        { primaryCol: 1, valueCol: "one" },
+        { primaryCol: 2, valueCol: "two" },
+      ]);
+      const upserted = realm.createAll(
+        "IntPrimaryObject",
+        [
+          { primaryCol: 1, valueCol: "uno" },
+          { primaryCol: 3, valueCol: "three" },
+        ],
+        "modified",
+      );
+      TestCase.assertEqual(upserted[0].valueCol, "uno");
+      TestCase.assertEqual(upserted[1].valueCol, "three");
+    });
+    TestCase.assertEqual(realm.objects("IntPrimaryObject").length, 3);
+
+    realm.write(() => {
+      TestCase.assertThrowsContaining(() => {
+        realm.createAll("TestObject", [{ doubleCol: 4 }], "sometimes");
+      }, "Unsupported 'updateMode'");
+    });
+
+    realm.close();
+  },
+
+  testRealmWriteAsync: async function () {
+    const realm = new Realm({ schema: [schemas.TestObject] });
+    const objects = realm.objects("TestObject");
+
+    const promise = realm.writeAsync(() => {
+      realm.create("TestObject", { doubleCol: 1 });
+      return "done";
+    });
+    // The callback is queued through the event loop, so the submitting
+    // stack sees the Realm unchanged.
+    TestCase.assertEqual(objects.length, 0);
+
+    const result = await promise;
+    TestCase.assertEqual(result, "done");
+    TestCase.assertEqual(objects.length, 1);
+
+    // Queued writes run in submission order.
+    const order = [];
+    await Promise.all([realm.writeAsync(() => order.push("first")), realm.writeAsync(() => order.push("second"))]);
+    TestCase.assertArraysEqual(order, ["first", "second"]);
+
+    // A throwing callback rejects its own write without poisoning later ones.
+    await TestCase.assertThrowsAsyncContaining(
+      () =>
+        realm.writeAsync(() => {
+          throw new Error("boom");
+        }),
+      "boom",
+    );
+    await realm.writeAsync(() => realm.create("TestObject", { doubleCol: 2 }));
+    TestCase.assertEqual(objects.length, 2);
+
+    realm.close();
+  },
+
+  testRealmBatchedWrites: async function () {
+    const realm = new Realm({ schema: [schemas.TestObject], batchedWrites: true });
+    const objects = realm.objects("TestObject");
+
+    await Promise.all([
+      realm.writeAsync(() => realm.create("TestObject", { doubleCol: 1 })),
+      realm.writeAsync(() => realm.create("TestObject", { doubleCol: 2 })),
+    ]);
+    TestCase.assertEqual(objects.length, 2);
+
+    // A throwing callback only rejects its own entry; the rest of the
+    // batch still commits.
+    const settled = await Promise.allSettled([
+      realm.writeAsync(() => realm.create("TestObject", { doubleCol: 3 })),
+      realm.writeAsync(() => {
+        throw new Error("boom");
+      }),
+      realm.writeAsync(() => realm.create("TestObject", { doubleCol: 4 })),
+    ]);
+    TestCase.assertEqual(settled[0].status, "fulfilled");
+    TestCase.assertEqual(settled[1].status, "rejected");
+    TestCase.assertEqual(settled[2].status, "fulfilled");
+    TestCase.assertEqual(objects.length, 4);
+
+    realm.close();
+  },
+
+  testRealmFreeze: function () {
+    const realm = new Realm({ schema: [schemas.TestObject] });
+    realm.write(() => {
+      realm.create("TestObject", { doubleCol: 1 });
+    });
+
+    const frozen = realm.freeze();
+    TestCase.assertTrue(frozen.isFrozen);
+    TestCase.assertFalse(realm.isFrozen);
+
+    realm.write(() => {
+      realm.create("TestObject", { doubleCol: 2 });
+    });
+
+    // The frozen Realm stays pinned to the version it was created at.
+    TestCase.assertEqual(realm.objects("TestObject").length, 2);
+    TestCase.assertEqual(frozen.objects("TestObject").length, 1);
+
+    const frozenObject = realm.objects("TestObject")[0].freeze();
+    TestCase.assertTrue(frozenObject.isFrozen);
+    TestCase.assertEqual(frozenObject.doubleCol, 1);
+
+    TestCase.assertThrows(() => {
+      frozen.write(() => {});
+    });
+
+    realm.close();
+  },
+
+  testRealmObjectsForPrimaryKeys: function () {
+    const realm = new Realm({ schema: [schemas.IntPrimary, schemas.TestObject] });
+    realm.write(() => {
+      realm.create("IntPrimaryObject", { primaryCol: 1, valueCol: "one" });
+      realm.create("IntPrimaryObject", { primaryCol: 2, valueCol: "two" });
+    });
+
+    // The result array is aligned to the keys, with null for misses.
+    const resolved = realm.objectsForPrimaryKeys("IntPrimaryObject", [2, 99, 1]);
+    TestCase.assertEqual(resolved.length, 3);
+    TestCase.assertEqual(resolved[0].valueCol, "two");
+    TestCase.assertNull(resolved[1]);
+    TestCase.assertEqual(resolved[2].valueCol, "one");
+
+    TestCase.assertThrowsContaining(() => {
+      realm.objectsForPrimaryKeys("TestObject", [1]);
+    }, "does not have a primary key defined");
+
+    realm.close();
+  },
+
+  testRealmCompactAsync: async function () {
+    const realm = new Realm({ schema: [schemas.TestObject] });
+    realm.write(() => {
+      for (let i = 0; i < 100; i++) {
+        realm.create("TestObject", { doubleCol: i });
+      }
+    });
+    realm.write(() => {
+      realm.deleteAll();
+    });
+
+    const compacted = await realm.compactAsync();
+    TestCase.assertType(compacted, "boolean");
+
+    // The Realm stays usable on the calling thread either way.
+    realm.write(() => {
+      realm.create("TestObject", { doubleCol: 1 });
+    });
+    TestCase.assertEqual(realm.objects("TestObject").length, 1);
+
+    realm.beginTransaction();
+    await TestCase.assertThrowsAsyncContaining(() => realm.compactAsync(), "within a transaction");
+    realm.cancelTransaction();
+
+    realm.close();
+  },
+
+  testRealmDeleteAllAsync: async function () {
+    const realm = new Realm({ schema: [schemas.TestObject, schemas.IntPrimary] });
+    realm.write(() => {
+      realm.create("TestObject", { doubleCol: 1 });
+      realm.create("TestObject", { doubleCol: 2 });
+      realm.create("IntPrimaryObject", { primaryCol: 1, valueCol: "one" });
+    });
+
+    await realm.deleteAllAsync();
+    TestCase.assertEqual(realm.objects("TestObject").length, 0);
+    TestCase.assertEqual(realm.objects("IntPrimaryObject").length, 0);
+
+    realm.beginTransaction();
+    await TestCase.assertThrowsAsyncContaining(() => realm.deleteAllAsync(), "within a transaction");
+    realm.cancelTransaction();
+
+    realm.close();
+  },
 };
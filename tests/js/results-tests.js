@@ -53,6 +53,31 @@ module.exports = {
     TestCase.assertEqual(objects.length, 1);
   },
 
+  testResultsSlice: function () {
+    var realm = new Realm({ schema: [schemas.TestObject] });
+    var objects = realm.objects("TestObject");
+
+    realm.write(function () {
+      for (var i = 0; i < 10; i++) {
+        realm.create("TestObject", { doubleCol: i });
+      }
+    });
+
+    var all = objects.slice();
+    TestCase.assertTrue(Array.isArray(all));
+    TestCase.assertEqual(all.length, 10);
+    TestCase.assertEqual(all[3].doubleCol, 3);
+
+    var window = objects.slice(2, 5);
+    TestCase.assertEqual(window.length, 3);
+    TestCase.assertEqual(window[0].doubleCol, 2);
+    TestCase.assertEqual(window[2].doubleCol, 4);
+
+    TestCase.assertEqual(objects.slice(-2).length, 2);
+    TestCase.assertEqual(objects.slice(8, 100).length, 2);
+    TestCase.assertEqual(objects.slice(10).length, 0);
+  },
+
   testResultsSubscript: function () {
     var realm = new Realm({ schema: [schemas.PersonObject] });
     TestCase.assertEqual(realm.objects("PersonObject")[0], undefined);
@@ -1017,4 +1042,169 @@ module.exports = {
 
     realm.close();
   },
+
+  testResultsCount: function () {
+    var realm = new Realm({ schema: [schemas.NullableBasicTypes] });
+    var objects = realm.objects("NullableBasicTypesObject");
+
+    TestCase.assertEqual(objects.count(), 0);
+
+    realm.write(function () {
+      realm.create("NullableBasicTypesObject", { intCol: 1, stringCol: "a" });
+      realm.create("NullableBasicTypesObject", { intCol: 2 });
+      realm.create("NullableBasicTypesObject", { stringCol: "c" });
+    });
+
+    TestCase.assertEqual(objects.count(), 3);
+    TestCase.assertEqual(objects.count("intCol"), 2);
+    TestCase.assertEqual(objects.count("stringCol"), 2);
+    TestCase.assertEqual(objects.count("boolCol"), 0);
+
+    TestCase.assertThrowsContaining(function () {
+      objects.count("missingCol");
+    }, "Property 'missingCol' does not exist");
+
+    realm.close();
+  },
+
+  testResultsCursor: function () {
+    var realm = new Realm({ schema: [schemas.TestObject] });
+    realm.write(function () {
+      for (var i = 0; i < 10; i++) {
+        realm.create("TestObject", { doubleCol: i });
+      }
+    });
+    var objects = realm.objects("TestObject");
+
+    var cursor = objects.cursor();
+    TestCase.assertEqual(cursor.position, 0);
+
+    var batch = cursor.next(4);
+    TestCase.assertEqual(batch.values.length, 4);
+    TestCase.assertFalse(batch.done);
+    TestCase.assertEqual(batch.values[0].doubleCol, 0);
+    TestCase.assertEqual(cursor.position, 4);
+
+    batch = cursor.next(4);
+    TestCase.assertEqual(batch.values.length, 4);
+    TestCase.assertFalse(batch.done);
+    TestCase.assertEqual(batch.values[0].doubleCol, 4);
+
+    batch = cursor.next(4);
+    TestCase.assertEqual(batch.values.length, 2);
+    TestCase.assertTrue(batch.done);
+    TestCase.assertEqual(cursor.position, 10);
+
+    // A drained cursor keeps reporting done with no values.
+    batch = cursor.next();
+    TestCase.assertEqual(batch.values.length, 0);
+    TestCase.assertTrue(batch.done);
+
+    // The default batch size covers this whole collection.
+    batch = objects.cursor().next();
+    TestCase.assertEqual(batch.values.length, 10);
+    TestCase.assertTrue(batch.done);
+
+    realm.close();
+  },
+
+  testResultsWindow: function () {
+    var realm = new Realm({ schema: [schemas.TestObject] });
+    var objects = realm.objects("TestObject");
+
+    realm.write(function () {
+      for (var i = 0; i < 10; i++) {
+        realm.create("TestObject", { doubleCol: i });
+      }
+    });
+
+    var window = objects.window(2, 3);
+    TestCase.assertTrue(Array.isArray(window));
+    TestCase.assertEqual(window.length, 3);
+    TestCase.assertEqual(window[0].doubleCol, 2);
+    TestCase.assertEqual(window[2].doubleCol, 4);
+
+    TestCase.assertEqual(objects.window().length, 10);
+    TestCase.assertEqual(objects.window(8, 100).length, 2);
+    TestCase.assertEqual(objects.window(10).length, 0);
+
+    TestCase.assertThrows(function () {
+      objects.window(-1);
+    });
+    TestCase.assertThrows(function () {
+      objects.window(0, -1);
+    });
+
+    realm.close();
+  },
+
+  testResultsFreeze: function () {
+    var realm = new Realm({ schema: [schemas.TestObject] });
+    var objects = realm.objects("TestObject");
+
+    realm.write(function () {
+      realm.create("TestObject", { doubleCol: 1 });
+    });
+
+    var frozen = objects.freeze();
+    TestCase.assertTrue(frozen.isFrozen);
+    TestCase.assertFalse(objects.isFrozen);
+
+    realm.write(function () {
+      realm.create("TestObject", { doubleCol: 2 });
+    });
+
+    // The frozen copy stays pinned to its version while the live
+    // collection moves on.
+    TestCase.assertEqual(objects.length, 2);
+    TestCase.assertEqual(frozen.length, 1);
+    TestCase.assertEqual(frozen[0].doubleCol, 1);
+    TestCase.assertTrue(frozen[0].isFrozen);
+
+    realm.close();
+  },
+
+  testResultsChangeIndexesAreTypedArrays: async function () {
+    const realm = new Realm({ schema: [schemas.TestObject] });
+    const objects = realm.objects("TestObject");
+
+    let resolve;
+    objects.addListener((collection, changes) => {
+      if (resolve) {
+        resolve(changes);
+        resolve = undefined;
+      }
+    });
+    let changes = await new Promise((r) => (resolve = r));
+    TestCase.assertInstanceOf(changes.insertions, Uint32Array);
+
+    realm.write(() => {
+      realm.create("TestObject", { doubleCol: 1 });
+      realm.create("TestObject", { doubleCol: 2 });
+    });
+    changes = await new Promise((r) => (resolve = r));
+
+    TestCase.assertInstanceOf(changes.insertions, Uint32Array);
+    TestCase.assertInstanceOf(changes.deletions, Uint32Array);
+    TestCase.assertInstanceOf(changes.newModifications, Uint32Array);
+    TestCase.assertInstanceOf(changes.oldModifications, Uint32Array);
+    TestCase.assertArraysEqual(Array.from(changes.insertions), [0, 1]);
+    objects.removeAllListeners();
+
+    // Listeners that mutate the index arrays can opt back into plain arrays.
+    objects.addListener(
+      (collection, legacyChanges) => {
+        if (resolve) {
+          resolve(legacyChanges);
+          resolve = undefined;
+        }
+      },
+      { legacyChangeArrays: true },
+    );
+    changes = await new Promise((r) => (resolve = r));
+    TestCase.assertTrue(Array.isArray(changes.insertions));
+    objects.removeAllListeners();
+
+    realm.close();
+  },
 };
@@ -535,4 +535,48 @@ module.exports = {
 
     intRealm.close();
   },
+
+  async testSetAlgebra() {
+    const teamSchema = {
+      name: "Team",
+      properties: {
+        names: "string<>",
+      },
+    };
+    const realm = new Realm({ schema: [teamSchema] });
+
+    let teamA, teamB, core;
+    realm.write(() => {
+      teamA = realm.create("Team", { names: ["alice", "bob", "carol"] });
+      teamB = realm.create("Team", { names: ["bob", "carol", "dan"] });
+      core = realm.create("Team", { names: ["bob", "carol"] });
+    });
+
+    TestCase.assertArraysEqual(teamA.names.intersection(teamB.names).sort(), ["bob", "carol"]);
+    TestCase.assertArraysEqual(teamA.names.union(teamB.names).sort(), ["alice", "bob", "carol", "dan"]);
+    TestCase.assertArraysEqual(teamA.names.difference(teamB.names).sort(), ["alice"]);
+    TestCase.assertArraysEqual(teamB.names.difference(teamA.names).sort(), ["dan"]);
+
+    TestCase.assertFalse(teamA.names.isSubsetOf(teamB.names));
+    TestCase.assertTrue(core.names.isSubsetOf(teamA.names));
+    TestCase.assertTrue(core.names.isSubsetOf(core.names));
+
+    TestCase.assertThrowsContaining(() => {
+      teamA.names.intersection(["bob"]);
+    }, "Argument must be a Realm Set.");
+
+    // Operands must live in the same Realm; a set's links are only
+    // meaningful within the Realm that owns them.
+    const otherRealm = new Realm({ schema: [teamSchema], path: "setAlgebraOther.realm" });
+    let otherTeam;
+    otherRealm.write(() => {
+      otherTeam = otherRealm.create("Team", { names: ["bob"] });
+    });
+    TestCase.assertThrowsContaining(() => {
+      teamA.names.intersection(otherTeam.names);
+    }, "Both Sets must belong to the same Realm.");
+
+    otherRealm.close();
+    realm.close();
+  },
 };
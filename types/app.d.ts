@@ -352,6 +352,36 @@ declare namespace Realm {
      * Specifying this will enable the server to respond differently to specific versions of specific apps.
      */
     app?: LocalAppConfiguration;
+
+    /**
+     * Options for the sync client shared by all synced Realms of this app.
+     * These must be set before the first session starts, which is why they
+     * live on the app configuration.
+     */
+    sync?: SyncClientConfiguration;
+  }
+
+  /**
+   * Options for the sync client shared by all synced Realms of an app.
+   */
+  interface SyncClientConfiguration {
+    /**
+     * Multiplex all sync sessions over a single connection to the server
+     * instead of opening one connection per session. Recommended when many
+     * Realms are synced simultaneously.
+     */
+    multiplexSessions?: boolean;
+
+    /**
+     * Sync client timeouts, all in milliseconds.
+     */
+    timeouts?: {
+      connectTimeout?: number;
+      connectionLingerTime?: number;
+      pingKeepalivePeriod?: number;
+      pongKeepaliveTimeout?: number;
+      fastReconnectLimit?: number;
+    };
   }
 
   /**
@@ -474,6 +504,13 @@ declare namespace Realm {
      */
     callFunction(name: string, ...args: unknown[]): Promise<unknown>;
 
+    /**
+     * When true, function call arguments and results - as well as `watch()`
+     * change stream events - travel between JS and native as binary BSON
+     * buffers instead of stringified EJSON.
+     */
+    useBinaryFunctionCalls?: boolean;
+
     /**
      * Refresh the access token and derive custom data from it.
      *
@@ -24,10 +24,17 @@
 
 declare namespace Realm {
     interface CollectionChangeSet {
-        insertions: number[];
-        deletions: number[];
-        newModifications: number[];
-        oldModifications: number[];
+        insertions: Uint32Array | number[];
+        deletions: Uint32Array | number[];
+        newModifications: Uint32Array | number[];
+        oldModifications: Uint32Array | number[];
+    }
+
+    interface CollectionListenerOptions {
+        /**
+         * Deliver change indexes as plain number arrays instead of Uint32Arrays.
+         */
+        legacyChangeArrays?: boolean;
     }
 
     type CollectionChangeCallback<T> = (collection: Collection<T>, changes: CollectionChangeSet) => void;
@@ -119,6 +126,13 @@ declare namespace Realm {
         customHttpHeaders?: { [header: string]: string };
         newRealmFileBehavior?: OpenRealmBehaviorConfiguration;
         existingRealmFileBehavior?: OpenRealmBehaviorConfiguration;
+        /**
+         * Object type names whose availability resolves a `Realm.open()`
+         * promise early: once every named type has queryable objects in the
+         * local file, the promise resolves while the rest of the initial
+         * download keeps integrating in the background.
+         */
+        resolveWhenQueryable?: string[];
         ssl?: SSLConfiguration;
         _sessionStopPolicy?: SessionStopPolicy;
         error?: ErrorCallback;
@@ -128,10 +142,33 @@ declare namespace Realm {
         encryptionKey?: ArrayBuffer | ArrayBufferView | Int8Array;
         schema?: (ObjectClass | ObjectSchema)[];
         schemaVersion?: number;
-        shouldCompactOnLaunch?: (totalBytes: number, usedBytes: number) => boolean;
+        /**
+         * Either a callback asked on launch whether to compact, or a
+         * declarative policy evaluated natively without blocking the open on
+         * a round trip to the JS thread. A policy compacts when the file
+         * exceeds maxFileSizeBytes and/or the free-space ratio reaches
+         * minFreeSpaceRatio; every condition given must hold.
+         */
+        shouldCompactOnLaunch?:
+            | ((totalBytes: number, usedBytes: number) => boolean)
+            | { maxFileSizeBytes?: number; minFreeSpaceRatio?: number };
         path?: string;
         fifoFilesFallbackPath?: string;
         readOnly?: boolean;
+        /**
+         * Coalesce `writeAsync` calls arriving within the same event-loop
+         * turn into a single transaction. If any callback in a group throws,
+         * the group is rolled back and replayed one transaction per write,
+         * so callbacks should tolerate running more than once.
+         */
+        batchedWrites?: boolean;
+        /**
+         * Warm the OS page cache for the Realm file on a background thread
+         * right after opening, so first queries on cold storage don't stall
+         * on page faults. Pass a byte count to limit the prefetch to the
+         * front of the file.
+         */
+        prefetch?: 'sequential' | 'willneed' | number;
     }
 
     interface ConfigurationWithSync extends BaseConfiguration {
@@ -218,7 +255,11 @@ declare namespace Realm {
         /**
          * @returns void
          */
-        addListener(callback: ObjectChangeCallback): void;
+        /**
+         * Pass `propertyNames` to only be notified for changes to those
+         * properties; other changesets are dropped natively.
+         */
+        addListener(callback: ObjectChangeCallback, propertyNames?: string[]): void;
 
         removeListener(callback: ObjectChangeCallback): void;
 
@@ -228,6 +269,17 @@ declare namespace Realm {
          * @returns string
          */
         getPropertyType(propertyName: string) : string;
+
+        /**
+         * True if this object is pinned to a frozen version.
+         */
+        readonly isFrozen: boolean;
+
+        /**
+         * @returns an immutable, version-pinned copy of this object, safe to
+         * read from any thread.
+         */
+        freeze(): this;
     }
 
     /**
@@ -277,6 +329,18 @@ declare namespace Realm {
          */
         remove(key:string|string[]): DictionaryBase<ValueType>;
 
+        /**
+         * Adds all entries of the given object to the dictionary in a single native call
+         * @returns The dictionary
+         */
+        putAll(elements:{[key:string]: ValueType}): DictionaryBase<ValueType>;
+
+        /**
+         * Reads the requested keys (or all entries) out of the dictionary in a single native call
+         * @returns A plain object with the requested entries
+         */
+        getAll(keys?: string[]): {[key:string]: ValueType};
+
         /**
          * @returns void
          */
@@ -300,6 +364,13 @@ declare namespace Realm {
 
         description(): string;
 
+        /**
+         * Debug dump of the collection contents, limited to `maxRows` rows with
+         * the remainder elided. When `sink` is given the full dump is streamed
+         * through it in chunks and nothing is returned.
+         */
+        description(maxRows: number, sink?: (chunk: string) => void): string | undefined;
+
         /**
          * @returns boolean
          */
@@ -335,7 +406,7 @@ declare namespace Realm {
          * @param  {(collection:any,changes:any)=>void} callback
          * @returns void
          */
-        addListener(callback: CollectionChangeCallback<T>): void;
+        addListener(callback: CollectionChangeCallback<T>, options?: CollectionListenerOptions): void;
 
         /**
          * @returns void
@@ -376,6 +447,13 @@ declare namespace Realm {
 
         unshift(...object: T[]): number;
 
+        /**
+         * Append all elements of an array in a single native call.
+         * @param  {T[]} objects
+         * @returns number
+         */
+        extend(objects: T[]): number;
+
         /**
          * @param  {number} index
          * @param  {number} count?
@@ -383,6 +461,24 @@ declare namespace Realm {
          * @returns T
          */
         splice(index: number, count?: number, object?: any): T[];
+
+        /**
+         * Copy a non-optional int, float, double or date list into a typed
+         * array in a single native call. Dates export as epoch milliseconds.
+         * @returns Float64Array | Float32Array
+         */
+        toTypedArray(): Float64Array | Float32Array;
+
+        /**
+         * True if this list is pinned to a frozen version.
+         */
+        readonly isFrozen: boolean;
+
+        /**
+         * @returns an immutable, version-pinned copy of this list, safe to
+         * read from any thread.
+         */
+        freeze(): List<T>;
     }
 
     const List: {
@@ -423,6 +519,34 @@ declare namespace Realm {
          has(object: T): boolean;
 
          readonly size: number
+
+        /**
+         * Compute the intersection with another Realm Set in one native call.
+         * @param  {Realm.Set<T>} other
+         * @returns Array of the common elements
+         */
+        intersection(other: Realm.Set<T>): T[];
+
+        /**
+         * Compute the union with another Realm Set in one native call.
+         * @param  {Realm.Set<T>} other
+         * @returns Array of all distinct elements of both sets
+         */
+        union(other: Realm.Set<T>): T[];
+
+        /**
+         * Compute the difference to another Realm Set in one native call.
+         * @param  {Realm.Set<T>} other
+         * @returns Array of the elements only present in this set
+         */
+        difference(other: Realm.Set<T>): T[];
+
+        /**
+         * Check whether this set is a subset of another Realm Set.
+         * @param  {Realm.Set<T>} other
+         * @returns boolean
+         */
+        isSubsetOf(other: Realm.Set<T>): boolean;
     }
 
     const Set: {
@@ -442,6 +566,53 @@ declare namespace Realm {
          * @returns void
          */
         update(property: string, value: any): void;
+
+        /**
+         * Count the objects in the collection, or the non-null values of a property,
+         * in a single native call.
+         * @param  {string} property?
+         * @returns number
+         */
+        count(property?: string): number;
+
+        /**
+         * @returns a forward-only cursor yielding the collection in batches.
+         */
+        cursor(): ResultsCursor<T>;
+
+        /**
+         * Pagination window: returns the rows in [start, start + length) and
+         * pins exactly those rows' wrappers until the next window() call, so
+         * long scrolling sessions keep at most one window of live wrappers.
+         */
+        window(start?: number, length?: number): T[];
+
+        /**
+         * Like filtered(), but the query is evaluated on a background thread.
+         * @param  {string} query
+         * @param  {any[]} ...arg
+         * @returns Promise<Results>
+         */
+        filteredAsync(query: string, ...arg: any[]): Promise<Results<T>>;
+
+        /**
+         * Like sorted(), but the ordered view is materialized on a background
+         * thread, keeping large sorts off the event loop.
+         */
+        sortedAsync(reverse?: boolean): Promise<Results<T>>;
+        sortedAsync(descriptor: SortDescriptor[]): Promise<Results<T>>;
+        sortedAsync(descriptor: string, reverse?: boolean): Promise<Results<T>>;
+
+        /**
+         * True if this collection is pinned to a frozen version.
+         */
+        readonly isFrozen: boolean;
+
+        /**
+         * @returns an immutable, version-pinned copy of this collection, safe
+         * to read from any thread.
+         */
+        freeze(): Results<T>;
     }
 
     const Results: {
@@ -449,6 +620,15 @@ declare namespace Realm {
         readonly prototype: Results<any>;
     };
 
+    /**
+     * A forward-only cursor over a Results, yielding objects in batches without
+     * pinning a snapshot of the underlying view.
+     */
+    interface ResultsCursor<T> {
+        readonly position: number;
+        next(batchSize?: number): { values: T[]; done: boolean };
+    }
+
     /**
      * A primitive value, a BSON value or an object link.
      */
@@ -509,6 +689,18 @@ declare namespace Realm {
 
     type ConnectionNotificationCallback = (newState: ConnectionState, oldState: ConnectionState) => void;
 
+    interface SessionStats {
+        uploadedBytes: number;
+        uploadableBytes: number;
+        downloadedBytes: number;
+        downloadableBytes: number;
+        uploadProgressNotifications: number;
+        downloadProgressNotifications: number;
+        connects: number;
+        reconnects: number;
+        connectionChanges: number;
+    }
+
     namespace App.Sync {
         class Session {
             readonly config: SyncConfiguration;
@@ -525,6 +717,12 @@ declare namespace Realm {
 
             isConnected(): boolean;
 
+            /**
+             * Natively maintained transfer and connection counters for this
+             * session. Counting starts at the first call.
+             */
+            stats(): SessionStats | undefined;
+
             resume(): void;
             pause(): void;
 
@@ -642,6 +840,14 @@ declare class Realm {
     readonly isInTransaction: boolean;
     readonly isClosed: boolean;
 
+    /**
+     * While true, Realm-level "change" events are suppressed (listener
+     * registrations stay intact); events coalesce into one delivery when
+     * set back to false. Useful around bulk imports.
+     */
+    notificationsPaused: boolean;
+    readonly isFrozen: boolean;
+
     readonly syncSession: Realm.App.Sync.Session | null;
 
     /**
@@ -686,6 +892,15 @@ declare class Realm {
      */
     static exists(config: Realm.Configuration): boolean;
 
+    /**
+     * Returns a cached Realm instance for the configuration's path if this
+     * thread already has one open, skipping config parsing and coordinator
+     * setup; otherwise opens it as `new Realm(config)` would and caches it.
+     * @param  {Realm.Configuration} config?
+     * @returns Realm
+     */
+    static getCachedInstance(config?: Realm.Configuration | string): Realm;
+
     /**
      * @param  {Realm.Configuration} config?
      */
@@ -701,6 +916,12 @@ declare class Realm {
      */
     close(): void;
 
+    /**
+     * @returns an immutable Realm pinned to the current version, safe to read
+     * from any thread.
+     */
+    freeze(): Realm;
+
     /**
      * @param  {string} type
      * @param  {T} properties
@@ -719,6 +940,17 @@ declare class Realm {
     create<T extends Realm.Object>(type: {new(...arg: any[]): T; }, properties: RealmInsertionModel<T>, mode?: Realm.UpdateMode.Never): T;
     create<T extends Realm.Object>(type: {new(...arg: any[]): T; }, properties: Partial<T> | Partial<RealmInsertionModel<T>>, mode: Realm.UpdateMode.All | Realm.UpdateMode.Modified): T;
 
+    /**
+     * Create every object in `properties` in a single native call, resolving
+     * the schema once for the whole batch.
+     * @param  {string} type
+     * @param  {T[]} properties
+     * @param  {Realm.UpdateMode} mode? If not provided, `Realm.UpdateMode.Never` is used.
+     * @returns (T & Realm.Object)[]
+     */
+    createAll<T>(type: string, properties: RealmInsertionModel<T>[], mode?: Realm.UpdateMode.Never): (T & Realm.Object)[];
+    createAll<T>(type: string, properties: (Partial<T> | Partial<RealmInsertionModel<T>>)[], mode: Realm.UpdateMode.All | Realm.UpdateMode.Modified): (T & Realm.Object)[];
+
     /**
      * @param  {Realm.Object|Realm.Object[]|Realm.List<any>|Realm.Results<any>|any} object
      * @returns void
@@ -735,6 +967,12 @@ declare class Realm {
      */
     deleteAll(): void;
 
+    /**
+     * Wipe every table on a background thread, one bounded write transaction
+     * per table. Must not be called inside a transaction.
+     */
+    deleteAllAsync(): Promise<void>;
+
     /**
      * @param  {string} type
      * @param  {number|string|ObjectId|UUID} key
@@ -749,9 +987,18 @@ declare class Realm {
      */
     objectForPrimaryKey<T extends Realm.Object>(type: {new(...arg: any[]): T; }, key: Realm.PrimaryKey): T | undefined;
     
-    // Combined definitions 
+    // Combined definitions
     objectForPrimaryKey<T>(type: string | {new(...arg: any[]): T; }, key: Realm.PrimaryKey): (T & Realm.Object) | undefined;
 
+    /**
+     * Batch primary-key lookup: resolves all keys in one native pass.
+     * @param  {string} type
+     * @param  {Array} keys
+     * @returns an array aligned to `keys`, with null for keys with no match
+     */
+    objectsForPrimaryKeys<T>(type: string, keys: Realm.PrimaryKey[]): ((T & Realm.Object) | null)[];
+    objectsForPrimaryKeys<T extends Realm.Object>(type: {new(...arg: any[]): T; }, keys: Realm.PrimaryKey[]): (T | null)[];
+
     /**
      * @param  {string} type
      * @returns Realm.Results<T & Realm.Object>
@@ -795,6 +1042,15 @@ declare class Realm {
      */
     write<ReturnValueType>(callback: () => ReturnValueType): ReturnValueType;
 
+    /**
+     * Queue a write transaction to run asynchronously. The callback runs in
+     * its own transaction once the event loop turns, so the caller's stack
+     * is not stalled by the commit. Queued writes run in submission order.
+     * @param  {function()} callback
+     * @returns Promise resolving to the callback's return value
+     */
+    writeAsync<ReturnValueType>(callback: () => ReturnValueType): Promise<ReturnValueType>;
+
     /**
      * @returns void
      */
@@ -815,6 +1071,13 @@ declare class Realm {
      */
     compact(): boolean;
 
+    /**
+     * Compact on a background thread while the Realm stays open. Resolves
+     * with false if compaction could not take place (e.g. a write was in
+     * flight or versions were pinned); the calling thread never blocks.
+     */
+    compactAsync(): Promise<boolean>;
+
     /**
      * Write a copy to destination path
      * @param path destination path
@@ -823,6 +1086,15 @@ declare class Realm {
      */
     writeCopyTo(path: string, encryptionKey?: ArrayBuffer | ArrayBufferView): void;
 
+    /**
+     * Write a compacted copy on a background thread, pinning the current
+     * version so the JS thread stays responsive during multi-GB exports.
+     * @param path destination path
+     * @param encryptionKey encryption key to use
+     * @returns Promise resolving when the copy has been written
+     */
+    writeCopyToAsync(path: string, encryptionKey?: ArrayBuffer | ArrayBufferView): Promise<void>;
+
     /**
      * Update the schema of the Realm.
      *